@@ -0,0 +1,147 @@
+#include "AutoTune.h"
+#include "motor.h"
+#include "Param.h"
+#include "delay.h"
+#include <math.h>
+
+/*
+ * 继电器反馈自整定 (Astrom-Hagglund)：
+ * 开环给电机一个带滞环的继电器输出，速度低于设定值时占空比取BIAS+AMP，
+ * 高于设定值时取BIAS-AMP，系统会进入稳定的极限环振荡。
+ * 由振幅a和周期Tu得到临界增益 Ku = 4d / (pi * sqrt(a^2 - eps^2))，
+ * 再按Tyreus-Luyben规则计算PID参数 (比Ziegler-Nichols超调小)：
+ *   Kp = Ku / 2.2，Ti = 2.2 * Tu，Td = Tu / 6.3
+ * 整定时车轮会转动，需把车架空。
+ */
+
+void AutoTune_RelayInit(AutoTune_Relay *relay)
+{
+    relay->High = 1;
+    relay->Started = 0;
+    relay->Cycles = 0;
+    relay->LastRise = 0;
+    relay->Max = -1000.0f;
+    relay->Min = 1000.0f;
+    relay->SumAmp = 0;
+    relay->SumPeriod = 0;
+    relay->Count = 0;
+}
+
+// 输入第n个采样的速度，返回继电器输出的占空比
+float AutoTune_RelayStep(AutoTune_Relay *relay, float speed, uint32_t n)
+{
+    if (speed > relay->Max) relay->Max = speed;
+    if (speed < relay->Min) relay->Min = speed;
+
+    if (relay->High && speed > AUTOTUNE_SETPOINT + AUTOTUNE_HYST)
+    {
+        relay->High = 0;
+    }
+    else if (!relay->High && speed < AUTOTUNE_SETPOINT - AUTOTUNE_HYST)
+    {
+        // 上切：以两次上切之间为一个完整周期
+        relay->High = 1;
+        if (relay->Started)
+        {
+            relay->Cycles++;
+            if (relay->Cycles > AUTOTUNE_SKIP && relay->Count < AUTOTUNE_CYCLES)
+            {
+                relay->SumAmp += (relay->Max - relay->Min) / 2.0f;
+                relay->SumPeriod += (float)(n - relay->LastRise);
+                relay->Count++;
+            }
+        }
+        relay->Started = 1;
+        relay->LastRise = n;
+        relay->Max = speed;
+        relay->Min = speed;
+    }
+
+    return relay->High ? AUTOTUNE_BIAS + AUTOTUNE_AMP : AUTOTUNE_BIAS - AUTOTUNE_AMP;
+}
+
+// 是否已采集到足够的振荡周期
+uint8_t AutoTune_RelayDone(const AutoTune_Relay *relay)
+{
+    return relay->Count >= AUTOTUNE_CYCLES;
+}
+
+// 由振荡结果计算离散PID参数，dt为采样周期(s)；振幅不大于滞环时返回0
+uint8_t AutoTune_Gains(const AutoTune_Relay *relay, float dt, float *kp, float *ki, float *kd)
+{
+    float a, tu, ku, ti, td;
+
+    if (relay->Count == 0) return 0;
+
+    a = relay->SumAmp / relay->Count;
+    tu = relay->SumPeriod / relay->Count * dt;
+    if (a <= AUTOTUNE_HYST || tu <= 0) return 0;
+
+    ku = 4.0f * AUTOTUNE_AMP / (3.1416f * sqrtf(a * a - AUTOTUNE_HYST * AUTOTUNE_HYST));
+    *kp = ku / 2.2f;
+    ti = 2.2f * tu;
+    td = tu / 6.3f;
+
+    // PID_Calc中积分按采样累加、微分按采样差分
+    *ki = *kp * dt / ti;
+    *kd = *kp * td / dt;
+    return 1;
+}
+
+// 检查两轮的同一个参数：都在串口命令允许的0~PARAM_GAIN_MAX内 (NaN也不通过)，
+// 且相差不超过平均值的AUTOTUNE_MATCH，否则认为试验受到干扰 (车轮着地、打滑等)
+uint8_t AutoTune_Match(float left, float right)
+{
+    float avg = (left + right) / 2.0f;
+
+    if (!(left >= 0 && left <= PARAM_GAIN_MAX) || !(right >= 0 && right <= PARAM_GAIN_MAX))
+        return 0;
+    return fabsf(left - right) <= AUTOTUNE_MATCH * avg;
+}
+
+// 对两个车轮同时做继电器试验，结果通过检查后更新速度环参数并写入Flash (阻塞)
+uint8_t AutoTune_Run(void)
+{
+    AutoTune_Relay left, right;
+    float kp_l, ki_l, kd_l, kp_r, ki_r, kd_r;
+    float dt = MOTOR_PID_DIV / 1000.0f;
+    uint32_t start = millis();
+    uint32_t last = start;
+    uint32_t n = 0;
+
+    AutoTune_RelayInit(&left);
+    AutoTune_RelayInit(&right);
+    Motor_SetDuty(AUTOTUNE_BIAS + AUTOTUNE_AMP, AUTOTUNE_BIAS + AUTOTUNE_AMP);
+
+    while (!AutoTune_RelayDone(&left) || !AutoTune_RelayDone(&right))
+    {
+        if (millis() - start >= AUTOTUNE_TIMEOUT)
+        {
+            Motor_Stop();
+            return 0;
+        }
+
+        // 每个速度环周期取一次新的测速结果
+        if (millis() - last < MOTOR_PID_DIV) continue;
+        last += MOTOR_PID_DIV;
+        n++;
+
+        Motor_SetDuty(AutoTune_RelayStep(&left, Motor_GetLeftSpeed(), n),
+                      AutoTune_RelayStep(&right, Motor_GetRightSpeed(), n));
+    }
+    Motor_Stop();
+
+    if (!AutoTune_Gains(&left, dt, &kp_l, &ki_l, &kd_l) ||
+        !AutoTune_Gains(&right, dt, &kp_r, &ki_r, &kd_r))
+        return 0;
+    if (!AutoTune_Match(kp_l, kp_r) || !AutoTune_Match(ki_l, ki_r) || !AutoTune_Match(kd_l, kd_r))
+        return 0;
+
+    // 两轮共用一组参数，取平均
+    Param.MotorKp = (kp_l + kp_r) / 2.0f;
+    Param.MotorKi = (ki_l + ki_r) / 2.0f;
+    Param.MotorKd = (kd_l + kd_r) / 2.0f;
+    Motor_SetGains(Param.MotorKp, Param.MotorKi, Param.MotorKd);
+
+    return Param_Save();
+}
@@ -0,0 +1,37 @@
+#ifndef __AUTOTUNE_H
+#define __AUTOTUNE_H
+
+#include "stm32f10x.h"
+
+// 继电器反馈自整定参数
+#define AUTOTUNE_SETPOINT 50.0f // 振荡中心速度 (最大速度的百分比)
+#define AUTOTUNE_BIAS 50.0f     // 继电器中心占空比(%)
+#define AUTOTUNE_AMP 25.0f      // 继电器幅值 d (占空比%)
+#define AUTOTUNE_HYST 3.0f      // 继电器滞环 eps (速度%)，需大于测速噪声
+#define AUTOTUNE_SKIP 2         // 丢弃的起始振荡周期数
+#define AUTOTUNE_CYCLES 5       // 参与平均的振荡周期数
+#define AUTOTUNE_TIMEOUT 10000  // 整定超时(ms)
+#define AUTOTUNE_MATCH 0.3f     // 两轮整定结果允许的相对差 (相对两轮平均值)
+
+// 单个车轮的继电器振荡状态
+typedef struct
+{
+    uint8_t High;       // 继电器当前输出：1高，0低
+    uint8_t Started;    // 已出现第一次上切
+    uint8_t Cycles;     // 已完成的振荡周期数
+    uint32_t LastRise;  // 上次上切时的采样序号
+    float Max;          // 本周期速度最大值
+    float Min;          // 本周期速度最小值
+    float SumAmp;       // 振幅累加
+    float SumPeriod;    // 周期累加 (采样数)
+    uint8_t Count;      // 已累加的周期数
+} AutoTune_Relay;
+
+void AutoTune_RelayInit(AutoTune_Relay *relay);
+float AutoTune_RelayStep(AutoTune_Relay *relay, float speed, uint32_t n);
+uint8_t AutoTune_RelayDone(const AutoTune_Relay *relay);
+uint8_t AutoTune_Gains(const AutoTune_Relay *relay, float dt, float *kp, float *ki, float *kd);
+uint8_t AutoTune_Match(float left, float right);
+uint8_t AutoTune_Run(void);
+
+#endif
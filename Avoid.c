@@ -0,0 +1,96 @@
+#include "Avoid.h"
+
+/*
+ * 避障决策表：
+ * 超声停车或前方红外触发后，用RED1/RED2/RED5/RED6组成的4位索引查表，
+ * 直接得到要执行的动作程序。新增场景只需增加一段程序并修改表项。
+ * 每段程序都以"停车1s"开头。
+ */
+
+// 场景1/2及兜底: 后退 -> 左转 -> 前进5cm -> 左转 -> 直行
+static const Maneuver_Step Avoid_UTurnLeft[] = {
+    {MV_STOP, 100},
+    {MV_WAIT, 20},
+    {MV_BACK, 10},
+    {MV_TURN_LEFT, 0},
+    {MV_FORWARD, 5},
+    {MV_TURN_LEFT, 0},
+    {MV_RESUME, 0},
+    {MV_END, 0}
+};
+
+// 场景3: 后退 -> 右转 -> 前进5cm -> 右转 -> 直行
+static const Maneuver_Step Avoid_UTurnRight[] = {
+    {MV_STOP, 100},
+    {MV_WAIT, 20},
+    {MV_BACK, 10},
+    {MV_TURN_RIGHT, 0},
+    {MV_FORWARD, 5},
+    {MV_TURN_RIGHT, 0},
+    {MV_RESUME, 0},
+    {MV_END, 0}
+};
+
+// 场景4: RED1单触，从右侧绕过障碍
+static const Maneuver_Step Avoid_BypassRight[] = {
+    {MV_STOP, 100},
+    {MV_BACK, 10},
+    {MV_TURN_RIGHT, 0},
+    {MV_FORWARD, 5},
+    {MV_TURN_LEFT, 0},
+    {MV_FORWARD, 5},
+    {MV_TURN_LEFT, 0},
+    {MV_FORWARD, 5},
+    {MV_TURN_RIGHT, 0},
+    {MV_RESUME, 0},
+    {MV_END, 0}
+};
+
+// 场景5: RED2单触，从左侧绕过障碍
+static const Maneuver_Step Avoid_BypassLeft[] = {
+    {MV_STOP, 100},
+    {MV_BACK, 10},
+    {MV_TURN_LEFT, 0},
+    {MV_FORWARD, 5},
+    {MV_TURN_RIGHT, 0},
+    {MV_FORWARD, 5},
+    {MV_TURN_RIGHT, 0},
+    {MV_FORWARD, 5},
+    {MV_TURN_LEFT, 0},
+    {MV_RESUME, 0},
+    {MV_END, 0}
+};
+
+// 直行超时: 后退10cm -> 右转90度 -> 直行
+const Maneuver_Step Avoid_Timeout[] = {
+    {MV_BACK, 10},
+    {MV_TURN_RIGHT, 0},
+    {MV_RESUME, 0},
+    {MV_END, 0}
+};
+
+//                 RED6 RED5 RED2 RED1
+const Maneuver_Step *const Avoid_Table[16] = {
+    Avoid_UTurnLeft,   // 0  0    0    0    0   仅超声触发 -> 兜底
+    Avoid_BypassRight, // 1  0    0    0    1   场景4
+    Avoid_BypassLeft,  // 2  0    0    1    0   场景5
+    Avoid_UTurnLeft,   // 3  0    0    1    1   场景1
+    Avoid_UTurnLeft,   // 4  0    1    0    0   兜底
+    Avoid_UTurnLeft,   // 5  0    1    0    1   兜底
+    Avoid_UTurnLeft,   // 6  0    1    1    0   兜底
+    Avoid_UTurnRight,  // 7  0    1    1    1   场景3
+    Avoid_UTurnLeft,   // 8  1    0    0    0   兜底
+    Avoid_UTurnLeft,   // 9  1    0    0    1   兜底
+    Avoid_UTurnLeft,   // 10 1    0    1    0   兜底
+    Avoid_UTurnLeft,   // 11 1    0    1    1   场景2
+    Avoid_UTurnLeft,   // 12 1    1    0    0   兜底
+    Avoid_UTurnLeft,   // 13 1    1    0    1   兜底
+    Avoid_UTurnLeft,   // 14 1    1    1    0   兜底
+    Avoid_UTurnLeft    // 15 1    1    1    1   兜底
+};
+
+// 根据红外快照选择动作程序，O(1)
+const Maneuver_Step *Avoid_Select(uint8_t ir_mask)
+{
+    return Avoid_Table[AVOID_KEY(ir_mask)];
+}
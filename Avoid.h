@@ -0,0 +1,15 @@
+#ifndef __AVOID_H
+#define __AVOID_H
+
+#include "stm32f10x.h"
+#include "Maneuver.h"
+
+// 决策表索引：bit0=RED1, bit1=RED2, bit2=RED5, bit3=RED6 (1=有障碍)
+#define AVOID_KEY(ir_mask) ((uint8_t)(((ir_mask) & 0x03) | (((ir_mask) >> 2) & 0x0C)))
+
+extern const Maneuver_Step *const Avoid_Table[16];
+extern const Maneuver_Step Avoid_Timeout[];
+
+const Maneuver_Step *Avoid_Select(uint8_t ir_mask);
+
+#endif
@@ -0,0 +1,30 @@
+#include "Brake.h"
+#include "motor.h"
+#include "Encoder.h"
+#include "Param.h"
+
+/*
+ * 停车距离估计：
+ * 按两轮实测速度的平均值v计算 v*BRAKE_DELAY_S + v^2/(2*减速度)，
+ * 加到最小停车距离上作为超声波的停车触发距离。
+ * 低速时触发距离短，不会远离障碍就停车；高速时提前触发，不会冲过头。
+ */
+
+// 满速 (100%) 对应的车速 (cm/s)
+#define BRAKE_FULL_SPEED (MOTOR_MAX_COUNTS * (1000.0f / MOTOR_SPEED_WINDOW) / ENCODER_COUNTS_PER_CM)
+
+// 两轮实测平均车速 (cm/s，前进为正)
+float Brake_Speed(void)
+{
+    return (Motor_GetLeftSpeed() + Motor_GetRightSpeed()) * 0.5f * (BRAKE_FULL_SPEED / 100.0f);
+}
+
+// 以当前车速停车需要的距离 (cm)，后退或静止时为0
+float Brake_Distance(void)
+{
+    float v = Brake_Speed();
+
+    if (v <= 0 || Param.BrakeDecel <= 0)
+        return 0;
+    return v * BRAKE_DELAY_S + v * v / (2.0f * Param.BrakeDecel);
+}
@@ -0,0 +1,32 @@
+#ifndef __BRAKE_H
+#define __BRAKE_H
+
+#include "stm32f10x.h"
+
+// 停车方式 (Motor_Stop/Motor_Left_Brake/Motor_Right_Brake)
+#define BRAKE_COAST 0   // 四路清零，H桥高阻，电机惰行
+#define BRAKE_SHORT 1   // DRV8833两路输入全高，绕组短路刹车
+#define BRAKE_REVERSE 2 // 先反向驱动到轮速接近0，再短路刹车
+#ifndef BRAKE_MODE
+#define BRAKE_MODE BRAKE_SHORT
+#endif
+
+#define BRAKE_REVERSE_DUTY 60 // 反向脉冲占空比(%)
+#define BRAKE_REVERSE_MS 100  // 反向脉冲最长时间(ms)，防止编码器故障时一直反转
+#define BRAKE_REVERSE_MIN 5   // 轮速低于此值 (最大速度的百分比) 结束反向脉冲
+
+// 对应停车方式的减速度默认值 (cm/s^2)，需实测标定后用串口命令decel修改
+#if BRAKE_MODE == BRAKE_COAST
+#define BRAKE_DECEL 150.0f
+#elif BRAKE_MODE == BRAKE_SHORT
+#define BRAKE_DECEL 400.0f
+#else
+#define BRAKE_DECEL 500.0f
+#endif
+
+#define BRAKE_DELAY_S 0.02f // 决定停车到开始减速的延时(s)：决策任务周期 + PWM更新
+
+float Brake_Speed(void);
+float Brake_Distance(void);
+
+#endif
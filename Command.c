@@ -0,0 +1,245 @@
+#include "Command.h"
+#include "Serial.h"
+#include "Telemetry.h"
+#include "Param.h"
+#include "motor.h"
+#include "Maneuver.h"
+#include "Format.h"
+#include "Profile.h"
+#include "Latency.h"
+#include "AutoTune.h"
+
+/*
+ * 串口调参命令 (每行一条，以\r或\n结束)：
+ *   <名称> <数值>   设置参数，如 "kp 1.8"、"stop 20"
+ *   <名称>          查询参数
+ *   get             查询全部参数
+ *   save            停车并把当前参数写入Flash
+ *   default         恢复默认参数 (不写Flash)
+ *   clear           清零耗时统计和时间直方图
+ *   tune            停车后做速度环自整定并写入Flash (阻塞约10s，需把车架空)
+ * 应答通过遥测文本帧 (TLM_TEXT) 返回，避免打断二进制数据流。
+ */
+
+// 可调参数表
+typedef struct
+{
+    const char *Name;
+    float *Value;
+    float Min;
+    float Max;
+} Command_Param;
+
+static const Command_Param Cmd_Params[] = {
+    {"kp", &Param.MotorKp, 0, PARAM_GAIN_MAX},
+    {"ki", &Param.MotorKi, 0, PARAM_GAIN_MAX},
+    {"kd", &Param.MotorKd, 0, PARAM_GAIN_MAX},
+    {"lspeed", &Param.NormalLeft, 0, 99},
+    {"rspeed", &Param.NormalRight, 0, 99},
+    {"stop", &Param.StopDistance, 0, 200},
+    {"ttc", &Param.StopTtc, 0, 5},
+    {"decel", &Param.BrakeDecel, 0, 5000},
+    {"wall", &Param.WallAdjust, 0, 50},
+};
+#define CMD_PARAM_NUM (sizeof(Cmd_Params) / sizeof(Cmd_Params[0]))
+
+static char Cmd_Line[CMD_LINE_MAX];
+static uint8_t Cmd_Len = 0;
+static uint8_t Cmd_Overflow = 0; // 本行超长，丢弃到行尾
+
+// 字符串相等
+static uint8_t cmd_equal(const char *a, const char *b)
+{
+    while (*a && *a == *b)
+    {
+        a++;
+        b++;
+    }
+    return *a == *b;
+}
+
+/*
+ * 解析十进制数 ([+-]整数[.小数])，不依赖atof/strtod
+ * 小数部分先按整数累加，最后除一次10的幂，避免逐位乘0.1累积误差 (如"196.125"得到196.125015)
+ * 成功返回1；有非法字符或没有数字时返回0
+ */
+uint8_t Command_ParseFloat(const char *s, float *value)
+{
+    float result = 0;
+    uint32_t frac = 0;  // 小数部分的数字
+    uint32_t div = 1;   // 10^小数位数
+    uint8_t negative = 0;
+    uint8_t digits = 0;
+
+    if (*s == '-' || *s == '+')
+    {
+        negative = (*s == '-');
+        s++;
+    }
+    while (*s >= '0' && *s <= '9')
+    {
+        result = result * 10.0f + (*s - '0');
+        digits++;
+        s++;
+    }
+    if (*s == '.')
+    {
+        s++;
+        while (*s >= '0' && *s <= '9')
+        {
+            // 超过8位的小数已低于float精度，只检查不累加
+            if (div < 100000000)
+            {
+                frac = frac * 10 + (*s - '0');
+                div *= 10;
+            }
+            digits++;
+            s++;
+        }
+    }
+    if (*s != 0 || digits == 0)
+        return 0;
+
+    result += (float)frac / (float)div;
+    *value = negative ? -result : result;
+    return 1;
+}
+
+// 格式化 "名称=数值" (保留3位小数)
+static void cmd_reply_param(const Command_Param *p)
+{
+    char buf[CMD_LINE_MAX];
+    uint8_t n = 0;
+    const char *name = p->Name;
+    float v = *p->Value;
+    uint32_t ip, fp;
+
+    while (*name)
+    {
+        buf[n++] = *name++;
+    }
+    buf[n++] = '=';
+    if (v < 0)
+    {
+        buf[n++] = '-';
+        v = -v;
+    }
+    ip = (uint32_t)v;
+    fp = (uint32_t)((v - ip) * 1000.0f + 0.5f);
+    if (fp >= 1000)
+    {
+        ip++;
+        fp -= 1000;
+    }
+    n += Format_U32(buf + n, ip);
+    buf[n++] = '.';
+    Format_Dec(buf + n, fp, 3);
+    n += 3;
+    buf[n] = 0;
+    Telemetry_SendText(buf);
+}
+
+// 执行一行命令 (line会被修改)
+void Command_Execute(char *line)
+{
+    char *arg;
+    float value;
+    uint8_t i;
+
+    // 拆分命令名和参数
+    for (arg = line; *arg && *arg != ' '; arg++);
+    if (*arg == ' ')
+    {
+        *arg++ = 0;
+        while (*arg == ' ')
+            arg++;
+    }
+    if (line[0] == 0)
+        return;
+
+    if (cmd_equal(line, "get"))
+    {
+        for (i = 0; i < CMD_PARAM_NUM; i++)
+        {
+            cmd_reply_param(&Cmd_Params[i]);
+        }
+        return;
+    }
+    if (cmd_equal(line, "save"))
+    {
+        // 写Flash期间CPU暂停约20ms，先停车
+        Maneuver_Abort();
+        Motor_Stop();
+        Telemetry_SendText(Param_Save() ? "ok" : "err save");
+        return;
+    }
+    if (cmd_equal(line, "clear"))
+    {
+        Profile_Reset();
+        Latency_Reset();
+        Telemetry_SendText("ok");
+        return;
+    }
+    if (cmd_equal(line, "tune"))
+    {
+        Maneuver_Abort();
+        Motor_Stop();
+        Telemetry_SendText(AutoTune_Run() ? "ok" : "err tune");
+        return;
+    }
+    if (cmd_equal(line, "default"))
+    {
+        Param_Default();
+        Motor_SetGains(Param.MotorKp, Param.MotorKi, Param.MotorKd);
+        Telemetry_SendText("ok");
+        return;
+    }
+
+    for (i = 0; i < CMD_PARAM_NUM; i++)
+    {
+        if (!cmd_equal(line, Cmd_Params[i].Name))
+            continue;
+
+        if (*arg != 0)
+        {
+            if (!Command_ParseFloat(arg, &value) || value < Cmd_Params[i].Min || value > Cmd_Params[i].Max)
+            {
+                Telemetry_SendText("err value");
+                return;
+            }
+            *Cmd_Params[i].Value = value;
+            Motor_SetGains(Param.MotorKp, Param.MotorKi, Param.MotorKd);
+        }
+        cmd_reply_param(&Cmd_Params[i]);
+        return;
+    }
+    Telemetry_SendText("err cmd");
+}
+
+// 读取接收缓冲区，凑满一行后执行，由主循环周期调用
+void Command_Poll(void)
+{
+    uint8_t c;
+
+    while (Serial_Read(&c))
+    {
+        if (c == '\r' || c == '\n')
+        {
+            if (!Cmd_Overflow)
+            {
+                Cmd_Line[Cmd_Len] = 0;
+                Command_Execute(Cmd_Line);
+            }
+            Cmd_Len = 0;
+            Cmd_Overflow = 0;
+        }
+        else if (Cmd_Len < CMD_LINE_MAX - 1)
+        {
+            Cmd_Line[Cmd_Len++] = c;
+        }
+        else
+        {
+            Cmd_Overflow = 1;
+        }
+    }
+}
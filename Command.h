@@ -0,0 +1,12 @@
+#ifndef __COMMAND_H
+#define __COMMAND_H
+
+#include "stm32f10x.h"
+
+#define CMD_LINE_MAX 32 // 单行命令最大长度
+
+void Command_Poll(void);
+uint8_t Command_ParseFloat(const char *s, float *value);
+void Command_Execute(char *line);
+
+#endif
@@ -0,0 +1,82 @@
+#include "Encoder.h"
+
+static uint16_t Enc_LastLeft = 0;   // 上次读取的TIM3计数值
+static uint16_t Enc_LastRight = 0;  // 上次读取的TIM4计数值
+static volatile int32_t Enc_Left = 0;   // 左轮累计计数 (前进为正)
+static volatile int32_t Enc_Right = 0;  // 右轮累计计数 (前进为正)
+
+// 配置一个定时器为正交编码器模式
+static void Encoder_TimInit(TIM_TypeDef *TIMx)
+{
+    TIM_TimeBaseInitTypeDef TIM_TimeBaseInitStructure;
+    TIM_ICInitTypeDef TIM_ICInitStructure;
+
+    TIM_TimeBaseStructInit(&TIM_TimeBaseInitStructure);
+    TIM_TimeBaseInitStructure.TIM_ClockDivision = TIM_CKD_DIV1;
+    TIM_TimeBaseInitStructure.TIM_CounterMode = TIM_CounterMode_Up;
+    TIM_TimeBaseInitStructure.TIM_Period = 0xFFFF; // 满16位，回绕由Encoder_Update处理
+    TIM_TimeBaseInitStructure.TIM_Prescaler = 0;
+    TIM_TimeBaseInitStructure.TIM_RepetitionCounter = 0;
+    TIM_TimeBaseInit(TIMx, &TIM_TimeBaseInitStructure);
+
+    TIM_ICStructInit(&TIM_ICInitStructure);
+    TIM_ICInitStructure.TIM_Channel = TIM_Channel_1;
+    TIM_ICInitStructure.TIM_ICPolarity = TIM_ICPolarity_Rising;
+    TIM_ICInitStructure.TIM_ICFilter = 6;
+    TIM_ICInit(TIMx, &TIM_ICInitStructure);
+
+    TIM_ICInitStructure.TIM_Channel = TIM_Channel_2;
+    TIM_ICInit(TIMx, &TIM_ICInitStructure);
+
+    TIM_EncoderInterfaceConfig(TIMx, TIM_EncoderMode_TI12, TIM_ICPolarity_Rising, TIM_ICPolarity_Rising);
+    TIM_ClearFlag(TIMx, TIM_FLAG_Update);
+    TIM_SetCounter(TIMx, 0);
+    TIM_Cmd(TIMx, ENABLE);
+}
+
+void Encoder_Init(void)
+{
+    GPIO_InitTypeDef GPIO_InitStructure;
+
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOA | RCC_APB2Periph_GPIOB, ENABLE);
+    RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM3 | RCC_APB1Periph_TIM4, ENABLE);
+
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IPU;
+    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
+    GPIO_InitStructure.GPIO_Pin = GPIO_Pin_6 | GPIO_Pin_7;
+    GPIO_Init(GPIOA, &GPIO_InitStructure);
+    GPIO_Init(GPIOB, &GPIO_InitStructure);
+
+    Encoder_TimInit(TIM3);
+    Encoder_TimInit(TIM4);
+}
+
+// 把16位硬件计数累加为32位计数，两次调用之间计数变化不得超过32767
+void Encoder_Update(void)
+{
+    uint16_t left = TIM_GetCounter(TIM3);
+    uint16_t right = TIM_GetCounter(TIM4);
+
+    Enc_Left += ENCODER_LEFT_DIR * (int16_t)(left - Enc_LastLeft);
+    Enc_Right += ENCODER_RIGHT_DIR * (int16_t)(right - Enc_LastRight);
+    Enc_LastLeft = left;
+    Enc_LastRight = right;
+}
+
+// 左轮累计计数 (前进为正)
+int32_t Encoder_GetLeft(void)
+{
+    return Enc_Left;
+}
+
+// 右轮累计计数 (前进为正)
+int32_t Encoder_GetRight(void)
+{
+    return Enc_Right;
+}
+
+// 距离(cm)换算为编码器计数
+int32_t Encoder_CmToCounts(float cm)
+{
+    return (int32_t)(cm * ENCODER_COUNTS_PER_CM);
+}
@@ -0,0 +1,25 @@
+#ifndef __ENCODER_H
+#define __ENCODER_H
+
+#include "stm32f10x.h"
+
+// 编码器硬件连接 (与motor.h中MOTOR_TT1/MOTOR_TT2一致)
+// 左轮 TT1: PA6/PA7 -> TIM3_CH1/CH2
+// 右轮 TT2: PB6/PB7 -> TIM4_CH1/CH2
+
+// 编码器参数 - 根据实际电机和轮子调整
+#define ENCODER_COUNTS_PER_REV 1040  // 轮子转一圈的计数 (编码器线数*减速比*4倍频)
+#define WHEEL_DIAMETER_CM 6.5f       // 轮子直径(cm)
+#define ENCODER_COUNTS_PER_CM ((float)ENCODER_COUNTS_PER_REV / (3.1416f * WHEEL_DIAMETER_CM))
+
+// 前进时计数方向，装反时改为-1
+#define ENCODER_LEFT_DIR 1
+#define ENCODER_RIGHT_DIR 1
+
+void Encoder_Init(void);
+void Encoder_Update(void);
+int32_t Encoder_GetLeft(void);
+int32_t Encoder_GetRight(void);
+int32_t Encoder_CmToCounts(float cm);
+
+#endif
@@ -0,0 +1,62 @@
+#include "Format.h"
+
+/*
+ * 十进制从低位往高位倒序填充，每位只做一次除以常数10
+ * (编译器将其优化为乘法和移位，不用UDIV)；
+ * 十六进制和二进制直接移位取位，查表得到字符。
+ */
+
+static const char Format_HexDigit[16] = "0123456789ABCDEF";
+
+// 定长十进制
+void Format_Dec(char *Buf, uint32_t Number, uint8_t Length)
+{
+    uint32_t q;
+
+    while (Length)
+    {
+        q = Number / 10;
+        Buf[--Length] = (char)('0' + (Number - q * 10));
+        Number = q;
+    }
+}
+
+// 定长十六进制 (大写)
+void Format_Hex(char *Buf, uint32_t Number, uint8_t Length)
+{
+    while (Length)
+    {
+        Buf[--Length] = Format_HexDigit[Number & 0x0F];
+        Number >>= 4;
+    }
+}
+
+// 定长二进制
+void Format_Bin(char *Buf, uint32_t Number, uint8_t Length)
+{
+    while (Length)
+    {
+        Buf[--Length] = (char)('0' + (Number & 1));
+        Number >>= 1;
+    }
+}
+
+// 不补0的十进制，返回位数 (Buf至少FORMAT_DEC_MAX字节)
+uint8_t Format_U32(char *Buf, uint32_t Number)
+{
+    char tmp[FORMAT_DEC_MAX];
+    uint8_t n = 0, i;
+    uint32_t q;
+
+    do
+    {
+        q = Number / 10;
+        tmp[n++] = (char)('0' + (Number - q * 10));
+        Number = q;
+    } while (Number);
+    for (i = 0; i < n; i++)
+    {
+        Buf[i] = tmp[n - 1 - i];
+    }
+    return n;
+}
@@ -0,0 +1,19 @@
+#ifndef __FORMAT_H
+#define __FORMAT_H
+
+#include <stdint.h>
+
+/*
+ * 整数转字符 (不写结尾0)，供OLED显示和串口发送共用。
+ * 定长函数按原OLED_ShowNum的规则：高位补0，超出Length的高位被截掉。
+ */
+
+// 32位无符号十进制最多10位
+#define FORMAT_DEC_MAX 10
+
+void Format_Dec(char *Buf, uint32_t Number, uint8_t Length);
+void Format_Hex(char *Buf, uint32_t Number, uint8_t Length);
+void Format_Bin(char *Buf, uint32_t Number, uint8_t Length);
+uint8_t Format_U32(char *Buf, uint32_t Number);
+
+#endif
@@ -1,5 +1,11 @@
 #include "IRSensor.h"
 #include "delay.h"
+#include "motor.h"
+#include "Latency.h"
+
+static uint8_t IR_LastRaw = 0;    // 上一次快照的原始掩码
+static uint8_t IR_Stable = 0;     // 消抖后的掩码
+static volatile uint8_t IR_FrontEvent = 0; // 前方红外下降沿锁存 (IR_MASK_RED1/RED2)
 
 void IRSensor_Init(void)
 {
@@ -13,6 +19,86 @@ void IRSensor_Init(void)
     GPIO_InitStruct.GPIO_Mode = GPIO_Mode_IPU;  // 上拉输入，无障碍物时高电平，有障碍物时低电平
     GPIO_InitStruct.GPIO_Speed = GPIO_Speed_50MHz;
     GPIO_Init(IR_PORT, &GPIO_InitStruct);
+
+    IRSensor_FrontIrqInit();
+}
+
+/*
+ * 前方红外快速停车通道：
+ * RED1 (PA4) / RED2 (PA5) 下降沿 (出现障碍) 进入EXTI4 / EXTI9_5中断，
+ * 若两轮都在闭环前进，中断内直接Motor_Stop()清零TIM2比较值，
+ * 不必等5ms的红外任务和10ms的决策任务。
+ * 边沿同时锁存到IR_FrontEvent，决策任务用IRSensor_TakeFrontEvent()取走后照常选择避障动作。
+ *
+ * 优先级与SysTick相同 (抢占2)：两者互不打断，
+ * 避免SysTick算到一半被打断、返回后又把旧占空比写回比较寄存器。
+ */
+void IRSensor_FrontIrqInit(void)
+{
+    EXTI_InitTypeDef EXTI_InitStructure;
+    NVIC_InitTypeDef NVIC_InitStructure;
+
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_AFIO, ENABLE);
+
+    GPIO_EXTILineConfig(GPIO_PortSourceGPIOA, GPIO_PinSource4);
+    GPIO_EXTILineConfig(GPIO_PortSourceGPIOA, GPIO_PinSource5);
+    EXTI_InitStructure.EXTI_Line = EXTI_Line4 | EXTI_Line5;
+    EXTI_InitStructure.EXTI_Mode = EXTI_Mode_Interrupt;
+    EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Falling;
+    EXTI_InitStructure.EXTI_LineCmd = ENABLE;
+    EXTI_Init(&EXTI_InitStructure);
+    EXTI_ClearITPendingBit(EXTI_Line4 | EXTI_Line5);
+
+    NVIC_InitStructure.NVIC_IRQChannel = EXTI4_IRQn;
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 2;
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+    NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStructure);
+
+    NVIC_InitStructure.NVIC_IRQChannel = EXTI9_5_IRQn;
+    NVIC_Init(&NVIC_InitStructure);
+}
+
+// 前方红外出现障碍：前进中立即停车，并锁存给决策任务
+static void IRSensor_FrontEdge(uint8_t mask)
+{
+    IR_FrontEvent |= mask;
+    if (Motor_IsForward())
+    {
+        Latency_Obstacle(1);
+        Motor_Stop();
+    }
+}
+
+// 取走并清除锁存的前方红外事件 (IR_MASK_RED1/RED2位，0表示没有)
+uint8_t IRSensor_TakeFrontEvent(void)
+{
+    uint8_t mask;
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    mask = IR_FrontEvent;
+    IR_FrontEvent = 0;
+    __set_PRIMASK(primask);
+    return mask;
+}
+
+void EXTI4_IRQHandler(void)
+{
+    if (EXTI_GetITStatus(EXTI_Line4) == SET)
+    {
+        EXTI_ClearITPendingBit(EXTI_Line4);
+        IRSensor_FrontEdge(IR_MASK_RED1);
+    }
+}
+
+void EXTI9_5_IRQHandler(void)
+{
+    if (EXTI_GetITStatus(EXTI_Line5) == SET)
+    {
+        EXTI_ClearITPendingBit(EXTI_Line5);
+        IRSensor_FrontEdge(IR_MASK_RED2);
+    }
 }
 
 uint8_t IRSensor_Detect(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin)
@@ -27,3 +113,36 @@ uint8_t IRSensor_Detect(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin)
     // 低电平表示检测到障碍物(IR_HAVE_OBSTACLE)，高电平表示未检测到(IR_NO_OBSTACLE)
     return result == 0 ? IR_HAVE_OBSTACLE : IR_NO_OBSTACLE;
 }
+
+// 把GPIOA输入寄存器压缩成6位障碍物掩码 (低电平有效，取反后1=有障碍)
+// PA4/PA5 -> bit0/bit1, PA8/PA9 -> bit2/bit3, PA11/PA12 -> bit4/bit5
+uint8_t IRSensor_Pack(uint16_t idr)
+{
+    idr = ~idr;
+    return (uint8_t)(((idr >> 4) & 0x03) |
+                     ((idr >> 6) & 0x0C) |
+                     ((idr >> 7) & 0x30));
+}
+
+// 当前有效的传感器位：PA9被串口配置为USART1 TX (复用输出) 时，
+// 读到的是发送电平，发送数据时会出现假的RED4障碍，清除该位
+static uint8_t IRSensor_ValidMask(void)
+{
+    if (IR_PORT->CRH & GPIO_CRH_MODE9) // RED4_PIN (PA9) 的MODE位非0即为输出
+        return IR_MASK_ALL & ~IR_MASK_RED4;
+    return IR_MASK_ALL;
+}
+
+// 一次读取全部6路红外，返回消抖后的障碍物掩码 (IR_MASK_xxx)
+// 消抖：某一位连续两次快照相同才更新，否则保持上一次的稳定值，
+// 不再在读取之间插入Delay_us，6路传感器在同一时刻采样
+uint8_t IRSensor_Snapshot(void)
+{
+    uint8_t raw = IRSensor_Pack(GPIO_ReadInputData(IR_PORT));
+    uint8_t agree = (uint8_t)~(raw ^ IR_LastRaw);
+
+    IR_Stable = (IR_Stable & ~agree) | (raw & agree);
+    IR_LastRaw = raw;
+
+    return IR_Stable & IRSensor_ValidMask();
+}
@@ -16,8 +16,24 @@
 #define IR_HAVE_OBSTACLE  0   // Detected obstacle
 #define IR_NO_OBSTACLE    1   // No obstacle detected
 
+// 快照位掩码定义：对应位为1表示该传感器检测到障碍物
+#define IR_MASK_RED1   0x01
+#define IR_MASK_RED2   0x02
+#define IR_MASK_RED3   0x04
+#define IR_MASK_RED4   0x08
+#define IR_MASK_RED5   0x10
+#define IR_MASK_RED6   0x20
+#define IR_MASK_ALL    0x3F
+
+// 从快照中取出单个传感器状态 (IR_HAVE_OBSTACLE / IR_NO_OBSTACLE)
+#define IR_STATE(mask, bit) (((mask) & (bit)) ? IR_HAVE_OBSTACLE : IR_NO_OBSTACLE)
+
 // 函数声明
 void IRSensor_Init(void);
 uint8_t IRSensor_Detect(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin);
+uint8_t IRSensor_Snapshot(void);
+uint8_t IRSensor_Pack(uint16_t idr);
+void IRSensor_FrontIrqInit(void);
+uint8_t IRSensor_TakeFrontEvent(void);
 
 #endif
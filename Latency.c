@@ -0,0 +1,113 @@
+#include "Latency.h"
+#include "Telemetry.h"
+#include "delay.h"
+
+#if defined(__CC_ARM)
+#define LATENCY_CLZ(x) __clz(x)
+#else
+#define LATENCY_CLZ(x) __builtin_clz(x)
+#endif
+
+static Latency_Hist Lat_Hist[LATENCY_NUM];
+static uint32_t Lat_LastLoop = 0;
+static uint8_t Lat_LoopValid = 0;
+static volatile uint32_t Lat_SeenAt = 0; // 障碍物首次被看到的时刻 (us)
+static volatile uint8_t Lat_Armed = 0;   // 已看到障碍、尚未停车
+static uint8_t Lat_Next = 0;
+
+/*
+ * Latency_Obstacle和Latency_Stop (经Motor_Stop) 既在主循环中调用，也在红外EXTI中断中调用，
+ * 检查并修改Lat_Armed、更新直方图都在关中断下进行，避免被中断打断后重复或丢失记录。
+ * 保存并恢复调用者的PRIMASK，可以嵌套调用。
+ */
+
+void Latency_Add(Latency_Hist *h, uint32_t us)
+{
+    uint8_t bin = us > 1 ? 31 - LATENCY_CLZ(us) : 0;
+    uint32_t primask = __get_PRIMASK();
+
+    if (bin >= LATENCY_BINS)
+        bin = LATENCY_BINS - 1;
+    __disable_irq();
+    if (h->Bins[bin] != 0xFFFF)
+        h->Bins[bin]++;
+    h->Count++;
+    if (us > h->Max)
+        h->Max = us;
+    __set_PRIMASK(primask);
+}
+
+// 在避障决策任务开头调用，记录相邻两次执行的间隔
+void Latency_LoopTick(void)
+{
+    uint32_t now = micros();
+
+    if (Lat_LoopValid)
+        Latency_Add(&Lat_Hist[LATENCY_LOOP], now - Lat_LastLoop);
+    Lat_LastLoop = now;
+    Lat_LoopValid = 1;
+}
+
+// 传感器任务上报前方是否有障碍 (只在需要停车的行驶状态下调用)：
+// 由无到有时开始计时，障碍在停车前消失则放弃本次记录
+void Latency_Obstacle(uint8_t present)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    if (!present)
+    {
+        Lat_Armed = 0;
+    }
+    else if (!Lat_Armed)
+    {
+        Lat_SeenAt = micros();
+        Lat_Armed = 1;
+    }
+    __set_PRIMASK(primask);
+}
+
+// 由Motor_Stop()调用
+void Latency_Stop(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    if (Lat_Armed)
+    {
+        Lat_Armed = 0;
+        Latency_Add(&Lat_Hist[LATENCY_REACT], micros() - Lat_SeenAt);
+    }
+    __set_PRIMASK(primask);
+}
+
+void Latency_Reset(void)
+{
+    uint8_t i, j;
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    for (i = 0; i < LATENCY_NUM; i++)
+    {
+        for (j = 0; j < LATENCY_BINS; j++)
+            Lat_Hist[i].Bins[j] = 0;
+        Lat_Hist[i].Count = 0;
+        Lat_Hist[i].Max = 0;
+    }
+    Lat_LoopValid = 0;
+    Lat_Armed = 0;
+    __set_PRIMASK(primask);
+}
+
+const Latency_Hist *Latency_Get(uint8_t id)
+{
+    return id < LATENCY_NUM ? &Lat_Hist[id] : 0;
+}
+
+// 每次调用上报一个直方图 (轮流)
+void Latency_SendNext(void)
+{
+    Telemetry_SendHist(Lat_Next, &Lat_Hist[Lat_Next]);
+    if (++Lat_Next >= LATENCY_NUM)
+        Lat_Next = 0;
+}
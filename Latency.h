@@ -0,0 +1,33 @@
+#ifndef __LATENCY_H
+#define __LATENCY_H
+
+#include "stm32f10x.h"
+
+/*
+ * 时间分布直方图 (单位us，按2的幂分档)：
+ * 第0档为0~1us，第k档为 [2^k, 2^(k+1)) us，最后一档包含所有更大的值。
+ * 记录一次只需一条CLZ指令和一次加法。
+ */
+#define LATENCY_BINS 24 // 最后一档从2^23us (约8.4s) 起
+
+typedef struct
+{
+    uint16_t Bins[LATENCY_BINS]; // 各档次数，满65535后不再增加
+    uint32_t Count;
+    uint32_t Max; // 最大值 (us)
+} Latency_Hist;
+
+// 直方图编号
+#define LATENCY_LOOP 0  // 避障决策任务的实际周期
+#define LATENCY_REACT 1 // 障碍物首次被看到 -> Motor_Stop()写入PWM
+#define LATENCY_NUM 2
+
+void Latency_Add(Latency_Hist *h, uint32_t us);
+void Latency_LoopTick(void);
+void Latency_Obstacle(uint8_t present);
+void Latency_Stop(void);
+void Latency_Reset(void);
+const Latency_Hist *Latency_Get(uint8_t id);
+void Latency_SendNext(void);
+
+#endif
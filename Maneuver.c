@@ -0,0 +1,163 @@
+#include "Maneuver.h"
+#include "motor.h"
+#include "delay.h"
+#include "Param.h"
+#include "Ranging.h"
+
+/*
+ * 非阻塞动作执行器：
+ * Maneuver_Start()装入一段动作程序，之后由Maneuver_Tick()周期推进。
+ * 定时类步骤(停车/等待)按时间计时，移动类步骤(前进/后退/转向)由编码器
+ * 判定完成，到达目标即结束该步、进入下一步。
+ * 执行期间主循环照常采样传感器，需要时可用Maneuver_Abort()中止。
+ * 开始动作和每次转向结束时清空测距滤波器：车头换了方向，窗口中的旧样本和接近速度已不对应前方障碍。
+ */
+
+static const Maneuver_Step *Mv_Step = 0; // 当前步，0表示空闲
+static uint16_t Mv_Remain = 0;           // 当前步剩余时间(ms)
+
+// 开始执行一步，返回该步持续时间(ms)，移动类步骤返回0、由编码器判定完成
+static uint16_t Maneuver_Begin(const Maneuver_Step *step)
+{
+    switch (step->Op)
+    {
+    case MV_STOP:
+        Motor_Stop();
+        return step->Arg * 10;
+    case MV_WAIT:
+        return step->Arg * 10;
+    case MV_BACK:
+        Motor_MoveStart(-(float)step->Arg, BACK_SPEED, BACK_SPEED);
+        return 0;
+    case MV_FORWARD:
+        Motor_MoveStart(step->Arg, Param.NormalLeft, Param.NormalRight);
+        return 0;
+    case MV_TURN_LEFT:
+        Motor_TurnStart(90.0f);
+        return 0;
+    case MV_TURN_RIGHT:
+        Motor_TurnStart(-90.0f);
+        return 0;
+    case MV_RESUME:
+        Motor_ResumeNormal();
+        return 0;
+    default:
+        return 0;
+    }
+}
+
+// 当前步是否完成
+static uint8_t Maneuver_Done(const Maneuver_Step *step)
+{
+    switch (step->Op)
+    {
+    case MV_BACK:
+    case MV_FORWARD:
+        return Motor_MoveDone();
+    case MV_TURN_LEFT:
+    case MV_TURN_RIGHT:
+        return Motor_TurnDone();
+    default:
+        return Mv_Remain == 0;
+    }
+}
+
+// 结束一步：移动类动作结束时停车，转向结束时另外清空测距滤波器
+static void Maneuver_Finish(const Maneuver_Step *step)
+{
+    switch (step->Op)
+    {
+    case MV_BACK:
+    case MV_FORWARD:
+        Motor_Stop();
+        break;
+    case MV_TURN_LEFT:
+    case MV_TURN_RIGHT:
+        Motor_Stop();
+        Ranging_Reset();
+        break;
+    default:
+        break;
+    }
+}
+
+// 装入并开始执行一段动作程序 (不阻塞)
+void Maneuver_Start(const Maneuver_Step *program)
+{
+    if (program->Op == MV_END)
+    {
+        Mv_Step = 0;
+        return;
+    }
+    Ranging_Reset();
+    Mv_Step = program;
+    Mv_Remain = Maneuver_Begin(Mv_Step);
+    Maneuver_Tick(0); // 立即完成零时长的步骤
+}
+
+// 推进执行器，elapsed_ms为距上次调用经过的时间
+void Maneuver_Tick(uint16_t elapsed_ms)
+{
+    while (Mv_Step != 0)
+    {
+        if (Mv_Remain > elapsed_ms)
+        {
+            Mv_Remain -= elapsed_ms;
+            elapsed_ms = 0;
+        }
+        else
+        {
+            // 计时到期，多余的时间顺延给下一步
+            elapsed_ms -= Mv_Remain;
+            Mv_Remain = 0;
+        }
+        if (!Maneuver_Done(Mv_Step))
+            return;
+
+        Maneuver_Finish(Mv_Step);
+        Mv_Step++;
+        if (Mv_Step->Op == MV_END)
+        {
+            Mv_Step = 0;
+            return;
+        }
+        Mv_Remain = Maneuver_Begin(Mv_Step);
+    }
+}
+
+// 中止当前动作并停车
+void Maneuver_Abort(void)
+{
+    if (Mv_Step != 0)
+    {
+        Mv_Step = 0;
+        Motor_Stop();
+    }
+}
+
+// 是否有动作正在执行
+uint8_t Maneuver_IsBusy(void)
+{
+    return Mv_Step != 0;
+}
+
+// 当前正在执行的动作原语，空闲时返回MV_END
+uint8_t Maneuver_CurrentOp(void)
+{
+    return Mv_Step != 0 ? Mv_Step->Op : MV_END;
+}
+
+// 顺序执行一段动作程序 (阻塞)
+void Maneuver_Run(const Maneuver_Step *program)
+{
+    uint32_t last = millis();
+    uint32_t now;
+
+    Maneuver_Start(program);
+    while (Maneuver_IsBusy())
+    {
+        now = millis();
+        Maneuver_Tick(now - last);
+        last = now;
+    }
+}
@@ -0,0 +1,33 @@
+#ifndef __MANEUVER_H
+#define __MANEUVER_H
+
+#include "stm32f10x.h"
+
+// 动作原语
+typedef enum
+{
+    MV_END = 0,    // 程序结束
+    MV_STOP,       // 停车并等待 Arg*10 ms
+    MV_WAIT,       // 保持当前状态等待 Arg*10 ms
+    MV_BACK,       // 后退 Arg cm (编码器判定)
+    MV_FORWARD,    // 以正常直行速度前进 Arg cm (编码器判定)
+    MV_TURN_LEFT,  // 原地左转90度 (编码器判定)
+    MV_TURN_RIGHT, // 原地右转90度 (编码器判定)
+    MV_RESUME      // 恢复正常直行
+} Maneuver_Op;
+
+// 动作程序由若干步组成，以MV_END结尾
+typedef struct
+{
+    uint8_t Op;  // Maneuver_Op
+    uint8_t Arg; // 参数，含义见Maneuver_Op
+} Maneuver_Step;
+
+void Maneuver_Start(const Maneuver_Step *program);
+void Maneuver_Tick(uint16_t elapsed_ms);
+void Maneuver_Abort(void);
+uint8_t Maneuver_IsBusy(void);
+uint8_t Maneuver_CurrentOp(void);
+void Maneuver_Run(const Maneuver_Step *program);
+
+#endif
@@ -1,54 +1,191 @@
 #include "PID.h"
 
-// 定义PID结构体变量
-PID_TypeDef PID_MotorLeft;
-PID_TypeDef PID_MotorRight;
-
-void PID_Init(void)
-{
-    // Left motor PID parameters (Kp:1.5-3.5, Ki:0.05-0.2, Kd:0.03-0.1)
-    PID_MotorLeft.Kp = 2.5f;  // 比例系数 - 根据实际情况调整
-    PID_MotorLeft.Ki = 0.1f;  // 积分系数 - 根据实际情况调整
-    PID_MotorLeft.Kd = 0.05f;  // 微分系数 - 根据实际情况调整
-    PID_MotorLeft.Target = 0;
-    PID_MotorLeft.Actual = 0;
-    PID_MotorLeft.Error = 0;
-    PID_MotorLeft.LastError = 0;
-    PID_MotorLeft.SumError = 0;
-    PID_MotorLeft.Output = 0;
-    
-    // Right motor PID parameters (same as left for balance)
-    PID_MotorRight.Kp = 2.5f;  // 比例系数 - 根据实际情况调整
-    PID_MotorRight.Ki = 0.1f;  // 积分系数 - 根据实际情况调整
-    PID_MotorRight.Kd = 0.05f;  // 微分系数 - 根据实际情况调整
-    PID_MotorRight.Target = 0;
-    PID_MotorRight.Actual = 0;
-    PID_MotorRight.Error = 0;
-    PID_MotorRight.LastError = 0;
-    PID_MotorRight.SumError = 0;
-    PID_MotorRight.Output = 0;
+/*
+ * 通用PID：
+ * - 位置式：u = Kp*e + I + D + Kf*r，I += Ki*e + Kaw*(u限幅后 - u限幅前)
+ *   输出饱和时按超出量反算回退积分 (back-calculation)，退出饱和更快、超调更小
+ * - 增量式：u += Kp*(e-e1) + Ki*e + D + Kf*(r-r1)
+ *   输出本身就是积分状态，输出限幅即可防止积分饱和
+ * 两种模式的微分项都经过一阶低通：D += DFilter*(D原始 - D)
+ */
+
+// 限幅
+static float pid_limit(float x, float min, float max)
+{
+    if (x > max) return max;
+    if (x < min) return min;
+    return x;
+}
+
+// 设置模式、增益和输出范围，前馈/抗饱和/微分滤波取默认值，并清除运行状态
+void PID_Config(PID_TypeDef *pid, uint8_t mode, float kp, float ki, float kd, float out_min, float out_max)
+{
+    pid->Mode = mode;
+    pid->Kp = kp;
+    pid->Ki = ki;
+    pid->Kd = kd;
+    pid->Kf = 0;
+    pid->Kaw = 0;
+    pid->DFilter = 1.0f;
+    pid->OutMin = out_min;
+    pid->OutMax = out_max;
+    PID_Reset(pid);
+}
+
+// 清除运行状态 (积分、误差历史、输出)，增益不变
+void PID_Reset(PID_TypeDef *pid)
+{
+    pid->Target = 0;
+    pid->Actual = 0;
+    pid->Error = 0;
+    pid->LastError = 0;
+    pid->PrevError = 0;
+    pid->Integral = 0;
+    pid->DTerm = 0;
+    pid->Output = 0;
 }
 
 float PID_Calc(PID_TypeDef *pid, float target, float actual)
 {
+    float d_raw, out;
+
+    pid->Error = target - actual;
+
+    if (pid->Mode == PID_INCREMENTAL)
+    {
+        d_raw = pid->Kd * (pid->Error - 2.0f * pid->LastError + pid->PrevError);
+        pid->DTerm += pid->DFilter * (d_raw - pid->DTerm);
+
+        out = pid->Output
+            + pid->Kp * (pid->Error - pid->LastError)
+            + pid->Ki * pid->Error
+            + pid->DTerm
+            + pid->Kf * (target - pid->Target);
+        pid->Output = pid_limit(out, pid->OutMin, pid->OutMax);
+    }
+    else
+    {
+        d_raw = pid->Kd * (pid->Error - pid->LastError);
+        pid->DTerm += pid->DFilter * (d_raw - pid->DTerm);
+
+        out = pid->Kp * pid->Error + pid->Integral + pid->DTerm + pid->Kf * target;
+        pid->Output = pid_limit(out, pid->OutMin, pid->OutMax);
+
+        // 反算抗饱和：输出被限幅时，按超出量把积分往回拉
+        pid->Integral += pid->Ki * pid->Error + pid->Kaw * (pid->Output - out);
+        pid->Integral = pid_limit(pid->Integral, pid->OutMin, pid->OutMax);
+    }
+
+    pid->PrevError = pid->LastError;
+    pid->LastError = pid->Error;
     pid->Target = target;
     pid->Actual = actual;
-    pid->Error = pid->Target - pid->Actual;
-    
-    // Integral calculation (with anti-windup)
-    pid->SumError += pid->Error;
-    if(pid->SumError > 500) pid->SumError = 500;  // 积分上限 - 根据实际情况调整
-    if(pid->SumError < -500) pid->SumError = -500;  // 积分下限 - 根据实际情况调整
-    
-    // PID output calculation
-    pid->Output = pid->Kp * pid->Error + pid->Ki * pid->SumError + pid->Kd * (pid->Error - pid->LastError);
-    
-    // Output limit (0~100, match PWM range)
-    if(pid->Output > 100) pid->Output = 100;  // 输出上限 - 根据实际情况调整
-    if(pid->Output < 0) pid->Output = 0;  // 输出下限 - 根据实际情况调整
-    
-    // Save current error as last error for next calculation
+
+    return pid->Output;
+}
+
+// ================= 定点PID (Q16.16) =================
+
+// 64位中间结果饱和到32位
+static q16_t q16_sat(int64_t x)
+{
+    if (x > 0x7FFFFFFF) return 0x7FFFFFFF;
+    if (x < -0x7FFFFFFF - 1) return -0x7FFFFFFF - 1;
+    return (q16_t)x;
+}
+
+// 饱和加法
+static q16_t q16_add(q16_t a, q16_t b)
+{
+    return q16_sat((int64_t)a + b);
+}
+
+// 饱和减法
+static q16_t q16_sub(q16_t a, q16_t b)
+{
+    return q16_sat((int64_t)a - b);
+}
+
+// 饱和乘法 (SMULL后右移16位)
+static q16_t q16_mul(q16_t a, q16_t b)
+{
+    return q16_sat(((int64_t)a * b) >> 16);
+}
+
+// 限幅
+static q16_t q16_limit(q16_t x, q16_t min, q16_t max)
+{
+    if (x > max) return max;
+    if (x < min) return min;
+    return x;
+}
+
+void PIDQ_Config(PIDQ_TypeDef *pid, uint8_t mode, q16_t kp, q16_t ki, q16_t kd, q16_t out_min, q16_t out_max)
+{
+    pid->Mode = mode;
+    pid->Kp = kp;
+    pid->Ki = ki;
+    pid->Kd = kd;
+    pid->Kf = 0;
+    pid->Kaw = 0;
+    pid->DFilter = Q16_ONE;
+    pid->OutMin = out_min;
+    pid->OutMax = out_max;
+    PIDQ_Reset(pid);
+}
+
+void PIDQ_Reset(PIDQ_TypeDef *pid)
+{
+    pid->Target = 0;
+    pid->Actual = 0;
+    pid->Error = 0;
+    pid->LastError = 0;
+    pid->PrevError = 0;
+    pid->Integral = 0;
+    pid->DTerm = 0;
+    pid->Output = 0;
+}
+
+// 与PID_Calc()相同的算法，全部为整数运算
+q16_t PIDQ_Calc(PIDQ_TypeDef *pid, q16_t target, q16_t actual)
+{
+    q16_t d_raw, out;
+
+    pid->Error = q16_sub(target, actual);
+
+    if (pid->Mode == PID_INCREMENTAL)
+    {
+        // e - 2*e1 + e2 = (e - e1) - (e1 - e2)
+        d_raw = q16_mul(pid->Kd, q16_sub(q16_sub(pid->Error, pid->LastError),
+                                         q16_sub(pid->LastError, pid->PrevError)));
+        pid->DTerm = q16_add(pid->DTerm, q16_mul(pid->DFilter, q16_sub(d_raw, pid->DTerm)));
+
+        out = q16_add(pid->Output, q16_mul(pid->Kp, q16_sub(pid->Error, pid->LastError)));
+        out = q16_add(out, q16_mul(pid->Ki, pid->Error));
+        out = q16_add(out, pid->DTerm);
+        out = q16_add(out, q16_mul(pid->Kf, q16_sub(target, pid->Target)));
+        pid->Output = q16_limit(out, pid->OutMin, pid->OutMax);
+    }
+    else
+    {
+        d_raw = q16_mul(pid->Kd, q16_sub(pid->Error, pid->LastError));
+        pid->DTerm = q16_add(pid->DTerm, q16_mul(pid->DFilter, q16_sub(d_raw, pid->DTerm)));
+
+        out = q16_add(q16_mul(pid->Kp, pid->Error), pid->Integral);
+        out = q16_add(out, pid->DTerm);
+        out = q16_add(out, q16_mul(pid->Kf, target));
+        pid->Output = q16_limit(out, pid->OutMin, pid->OutMax);
+
+        // 反算抗饱和
+        pid->Integral = q16_add(pid->Integral, q16_mul(pid->Ki, pid->Error));
+        pid->Integral = q16_add(pid->Integral, q16_mul(pid->Kaw, q16_sub(pid->Output, out)));
+        pid->Integral = q16_limit(pid->Integral, pid->OutMin, pid->OutMax);
+    }
+
+    pid->PrevError = pid->LastError;
     pid->LastError = pid->Error;
-    
+    pid->Target = target;
+    pid->Actual = actual;
+
     return pid->Output;
 }
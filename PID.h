@@ -3,27 +3,73 @@
 
 #include "stm32f10x.h"
 
+// PID模式
+#define PID_POSITIONAL 0  // 位置式：输出 = P + I + D + 前馈
+#define PID_INCREMENTAL 1 // 增量式：输出 = 上次输出 + 增量
+
 // PID结构体定义
 typedef struct
 {
+    uint8_t Mode; // PID_POSITIONAL / PID_INCREMENTAL
+
     float Kp; // Proportional gain
     float Ki; // Integral gain
     float Kd; // Derivative gain
+    float Kf; // 前馈系数，输出叠加 Kf*Target (默认0)
+    float Kaw; // 反算抗饱和系数，仅位置式使用 (默认0，不反算)
+    float DFilter; // 微分一阶低通系数 0~1，越小滤波越强 (默认1，不滤波)
+    float OutMin; // 输出下限 (可为负，用于反转)
+    float OutMax; // 输出上限
 
     float Target;    // Target value
     float Actual;    // Actual value
     float Error;     // Current error
     float LastError; // Last error
-    float SumError;  // Sum of error (for integral)
+    float PrevError; // 上上次误差 (增量式用)
+    float Integral;  // 积分项 (位置式用，已乘Ki)
+    float DTerm;     // 滤波后的微分项
     float Output;    // PID output value
 } PID_TypeDef;
 
-// 外部使用的PID结构体（实际应用）
-extern PID_TypeDef PID_MotorLeft;
-extern PID_TypeDef PID_MotorRight;
-
 // 函数声明
-void PID_Init(void);
+void PID_Config(PID_TypeDef *pid, uint8_t mode, float kp, float ki, float kd, float out_min, float out_max);
+void PID_Reset(PID_TypeDef *pid);
 float PID_Calc(PID_TypeDef *pid, float target, float actual);
 
+// ================= 定点PID (Q16.16) =================
+// 无FPU时浮点运算全靠软件库，中断里改用定点版本：高16位整数，低16位小数
+typedef int32_t q16_t;
+
+#define Q16_ONE 65536
+#define Q16(x) ((q16_t)((x) * 65536.0f))          // 浮点常量转Q16.16
+#define Q16_TO_FLOAT(x) ((float)(x) / 65536.0f)   // Q16.16转浮点 (仅用于显示/调试)
+
+// 字段含义与PID_TypeDef相同，运算饱和不回绕
+typedef struct
+{
+    uint8_t Mode;
+
+    q16_t Kp;
+    q16_t Ki;
+    q16_t Kd;
+    q16_t Kf;
+    q16_t Kaw;
+    q16_t DFilter;
+    q16_t OutMin;
+    q16_t OutMax;
+
+    q16_t Target;
+    q16_t Actual;
+    q16_t Error;
+    q16_t LastError;
+    q16_t PrevError;
+    q16_t Integral;
+    q16_t DTerm;
+    q16_t Output;
+} PIDQ_TypeDef;
+
+void PIDQ_Config(PIDQ_TypeDef *pid, uint8_t mode, q16_t kp, q16_t ki, q16_t kd, q16_t out_min, q16_t out_max);
+void PIDQ_Reset(PIDQ_TypeDef *pid);
+q16_t PIDQ_Calc(PIDQ_TypeDef *pid, q16_t target, q16_t actual);
+
 #endif
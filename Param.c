@@ -0,0 +1,89 @@
+#include "Param.h"
+#include "motor.h"
+#include "Brake.h"
+
+Param_TypeDef Param;
+
+#define PARAM_WORDS (sizeof(Param_TypeDef) / 4)
+
+// 校验和：除Checksum外所有字的累加和取反
+static uint32_t Param_Checksum(const Param_TypeDef *p)
+{
+    const uint32_t *w = (const uint32_t *)p;
+    uint32_t sum = 0;
+    uint32_t i;
+
+    for (i = 0; i < PARAM_WORDS - 1; i++)
+    {
+        sum += w[i];
+    }
+    return ~sum;
+}
+
+// 恢复默认参数 (motor.h/Param.h/Brake.h中的宏定义值)
+void Param_Default(void)
+{
+    Param.Magic = PARAM_MAGIC;
+    Param.Size = sizeof(Param_TypeDef);
+    Param.MotorKp = MOTOR_KP;
+    Param.MotorKi = MOTOR_KI;
+    Param.MotorKd = MOTOR_KD;
+    Param.NormalLeft = NORMAL_LEFT_SPEED;
+    Param.NormalRight = NORMAL_RIGHT_SPEED;
+    Param.StopDistance = STOP_DISTANCE;
+    Param.StopTtc = STOP_TTC;
+    Param.BrakeDecel = BRAKE_DECEL;
+    Param.WallAdjust = WALL_ADJUST_SPEED;
+    Param.Checksum = Param_Checksum(&Param);
+}
+
+// 从Flash读取参数，返回1表示有效；无效时装入默认参数并返回0
+uint8_t Param_Load(void)
+{
+    const Param_TypeDef *stored = (const Param_TypeDef *)PARAM_ADDR;
+
+    if (stored->Magic == PARAM_MAGIC && stored->Size == sizeof(Param_TypeDef) &&
+        stored->Checksum == Param_Checksum(stored))
+    {
+        Param = *stored;
+        return 1;
+    }
+
+    Param_Default();
+    return 0;
+}
+
+// 写入Flash，返回1表示成功
+// 擦除一页约20ms，期间CPU取指暂停 (含中断)，只应在电机停止时调用
+uint8_t Param_Save(void)
+{
+    const uint32_t *w = (const uint32_t *)&Param;
+    uint32_t i;
+    FLASH_Status status;
+
+    Param.Magic = PARAM_MAGIC;
+    Param.Size = sizeof(Param_TypeDef);
+    Param.Checksum = Param_Checksum(&Param);
+
+    FLASH_Unlock();
+    FLASH_ClearFlag(FLASH_FLAG_EOP | FLASH_FLAG_PGERR | FLASH_FLAG_WRPRTERR);
+
+    status = FLASH_ErasePage(PARAM_ADDR);
+    for (i = 0; i < PARAM_WORDS && status == FLASH_COMPLETE; i++)
+    {
+        status = FLASH_ProgramWord(PARAM_ADDR + i * 4, w[i]);
+    }
+
+    FLASH_Lock();
+
+    if (status != FLASH_COMPLETE)
+        return 0;
+
+    // 回读校验
+    for (i = 0; i < PARAM_WORDS; i++)
+    {
+        if (((const uint32_t *)PARAM_ADDR)[i] != w[i])
+            return 0;
+    }
+    return 1;
+}
@@ -0,0 +1,45 @@
+#ifndef __PARAM_H
+#define __PARAM_H
+
+#include "stm32f10x.h"
+
+// 参数保存在Flash最后一页 (STM32F103C6共32KB，每页1KB)
+// 工程的IROM1已相应缩小为0x7C00，链接器不会把代码放进这一页
+#define PARAM_ADDR 0x08007C00
+#define PARAM_MAGIC 0x50415241 // "PARA"
+
+// 运行参数默认值 (可通过串口命令修改，见Command.c)
+#define STOP_DISTANCE 4.0f      // 超声波停车后留出的余量(cm)，触发距离另加按车速计算的刹车距离
+#define STOP_TTC 0.08f          // 超声波停车碰撞时间(s)：测量周期60ms + 任务周期20ms，不含刹车
+#define WALL_ADJUST_SPEED 15.0f // 巡墙纠偏时增加的目标速度(%)
+#define PARAM_GAIN_MAX 100.0f   // 速度环PID参数上限 (串口命令和自整定共用)
+
+// 需要掉电保存的参数，增删字段后Size不一致，旧数据自动作废
+typedef struct
+{
+    uint32_t Magic;
+    uint32_t Size; // sizeof(Param_TypeDef)
+
+    // 车轮速度环PID (自整定或手动设置)
+    float MotorKp;
+    float MotorKi;
+    float MotorKd;
+
+    // 行驶参数
+    float NormalLeft;   // 正常直行左轮速度(%)
+    float NormalRight;  // 正常直行右轮速度(%)
+    float StopDistance; // 超声波最小停车距离(cm)
+    float StopTtc;      // 超声波停车碰撞时间(s)
+    float BrakeDecel;   // 停车减速度(cm/s^2)，用于计算刹车距离
+    float WallAdjust;   // 巡墙纠偏增加的速度(%)
+
+    uint32_t Checksum; // 以上各字的累加和取反，必须放在最后
+} Param_TypeDef;
+
+extern Param_TypeDef Param;
+
+void Param_Default(void);
+uint8_t Param_Load(void);
+uint8_t Param_Save(void);
+
+#endif
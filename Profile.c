@@ -0,0 +1,100 @@
+#include "Profile.h"
+#include "Telemetry.h"
+
+/*
+ * 基于DWT周期计数器的耗时统计：
+ * 每个区域记录次数、最小/最大值和累计值，均值在读取时计算。
+ * 每个区域只应在一个执行环境 (某个中断或主循环) 中记录；
+ * 主循环读取中断正在更新的区域时可能读到不一致的一组值，只影响一次上报。
+ */
+
+static Profile_Region Prof_Table[PROF_NUM] = {
+    {"systick", 0, 0, 0, 0},
+    {"pid", 0, 0, 0, 0},
+    {"echo", 0, 0, 0, 0},
+    {"ir", 0, 0, 0, 0},
+    {"display", 0, 0, 0, 0},
+    {"tlm", 0, 0, 0, 0},
+};
+
+static uint32_t Prof_Overhead = 0; // 空探针的周期数
+static uint8_t Prof_Next = 0;      // 下一个上报的区域
+
+static uint32_t profile_elapsed(uint32_t start)
+{
+    uint32_t cycles = PROFILE_DWT_CYCCNT - start;
+    return cycles > Prof_Overhead ? cycles - Prof_Overhead : 0;
+}
+
+void Profile_Init(void)
+{
+    uint8_t i;
+    uint32_t start, cycles, best = 0xFFFFFFFF;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    PROFILE_DWT_CYCCNT = 0;
+    PROFILE_DWT_CTRL |= PROFILE_DWT_CYCCNTENA;
+
+    // 标定空探针的开销，之后每次测量都扣除
+    Prof_Overhead = 0;
+    for (i = 0; i < 16; i++)
+    {
+        start = PROFILE_BEGIN();
+        cycles = profile_elapsed(start);
+        if (cycles < best)
+            best = cycles;
+    }
+    Prof_Overhead = best;
+
+    Profile_Reset();
+}
+
+// 结束一次测量，start为PROFILE_BEGIN()的返回值
+void Profile_End(uint8_t id, uint32_t start)
+{
+    uint32_t cycles = profile_elapsed(start);
+    Profile_Region *r = &Prof_Table[id];
+
+    if (r->Count == 0 || cycles < r->Min)
+        r->Min = cycles;
+    if (cycles > r->Max)
+        r->Max = cycles;
+    r->Sum += cycles;
+    r->Count++;
+}
+
+void Profile_Reset(void)
+{
+    uint8_t i;
+    for (i = 0; i < PROF_NUM; i++)
+    {
+        Prof_Table[i].Count = 0;
+        Prof_Table[i].Min = 0;
+        Prof_Table[i].Max = 0;
+        Prof_Table[i].Sum = 0;
+    }
+}
+
+const Profile_Region *Profile_Get(uint8_t id)
+{
+    return id < PROF_NUM ? &Prof_Table[id] : 0;
+}
+
+// 标定得到的空探针开销 (周期)
+uint32_t Profile_GetOverhead(void)
+{
+    return Prof_Overhead;
+}
+
+uint32_t Profile_Mean(const Profile_Region *r)
+{
+    return r->Count ? (uint32_t)(r->Sum / r->Count) : 0;
+}
+
+// 每次调用上报一个区域 (轮流)，避免一次占满串口缓冲区
+void Profile_SendNext(void)
+{
+    Telemetry_SendProfile(Prof_Next, &Prof_Table[Prof_Next]);
+    if (++Prof_Next >= PROF_NUM)
+        Prof_Next = 0;
+}
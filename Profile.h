@@ -0,0 +1,56 @@
+#ifndef __PROFILE_H
+#define __PROFILE_H
+
+#include "stm32f10x.h"
+
+// 1: 启用探针，0: 探针宏为空，不占用时间
+#define PROFILE_ENABLE 1
+
+// DWT周期计数器 (core_cm3.h未定义DWT结构体，直接按地址访问)
+// 仿真时由sim/stm32f10x.h提供CYCCNT，每次读取计入探针开销
+#define PROFILE_DWT_CTRL (*(volatile uint32_t *)0xE0001000)
+#ifndef PROFILE_DWT_CYCCNT
+#define PROFILE_DWT_CYCCNT (*(volatile uint32_t *)0xE0001004)
+#endif
+#define PROFILE_DWT_CYCCNTENA 0x00000001
+
+// 探针区域编号，名称见Profile.c
+typedef enum
+{
+    PROF_SYSTICK = 0, // SysTick中断中的速度环 (Motor_ControlTick)
+    PROF_PID,         // 单个车轮的PID计算
+    PROF_ECHO,        // 超声波ECHO边沿中断
+    PROF_IR,          // 红外快照
+    PROF_DISPLAY,     // OLED绘制和刷新
+    PROF_TLM,         // 遥测打包发送
+    PROF_NUM
+} Profile_Id;
+
+// 单个区域的统计 (单位: CPU周期，已扣除探针自身开销)
+typedef struct
+{
+    const char *Name;
+    uint32_t Count;
+    uint32_t Min;
+    uint32_t Max;
+    uint64_t Sum;
+} Profile_Region;
+
+#if PROFILE_ENABLE
+// 用法: uint32_t t = PROFILE_BEGIN(); ... PROFILE_END(PROF_xxx, t);
+#define PROFILE_BEGIN() PROFILE_DWT_CYCCNT
+#define PROFILE_END(id, start) Profile_End(id, start)
+#else
+#define PROFILE_BEGIN() 0
+#define PROFILE_END(id, start) ((void)(start))
+#endif
+
+void Profile_Init(void);
+void Profile_End(uint8_t id, uint32_t start);
+void Profile_Reset(void);
+const Profile_Region *Profile_Get(uint8_t id);
+uint32_t Profile_GetOverhead(void);
+uint32_t Profile_Mean(const Profile_Region *r);
+void Profile_SendNext(void);
+
+#endif
@@ -0,0 +1,134 @@
+#include "Ranging.h"
+#include "Ultrasound.h"
+
+/*
+ * 超声波测距后处理：
+ * 1. 每次新测量 (Ultrasound_Read()返回的序号变化) 进入长度为RANGING_WINDOW的滑动窗口，取中值，
+ *    单次错误回波 (串扰、多径) 被中值剔除，不会再触发整套停车避障动作
+ * 2. 中值送入alpha-beta滤波器，同时估计距离和距离变化率，变化率取反即接近速度
+ * 3. 停车判断用碰撞时间：(距离 - 最小距离) / 接近速度 <= ttc，
+ *    车速快时提前停车，车速慢或静止时可以更靠近障碍物
+ *
+ * 采样间隔取超声波测量周期ULTRA_PERIOD，不受任务调度抖动影响。
+ * 距离匀速变化时中值比最新样本滞后(RANGING_WINDOW-1)/2个周期，输出时按估计速度外推补偿。
+ */
+
+#define RANGING_DELAY_S ((RANGING_WINDOW - 1) / 2 * (ULTRA_PERIOD / 1000000.0f))
+
+static float Rng_Window[RANGING_WINDOW];
+static uint8_t Rng_Count = 0;      // 窗口中的有效样本数
+static uint8_t Rng_Next = 0;       // 下一个写入位置
+static uint8_t Rng_Miss = 0;       // 连续无回波次数
+static uint8_t Rng_Init = 0;       // 滤波器已初始化
+static float Rng_Distance = -1.0f; // 滤波后的距离 (cm)，-1无效
+static float Rng_Rate = 0;         // 距离变化率 (cm/s)，接近为负
+
+void Ranging_Reset(void)
+{
+    Rng_Count = 0;
+    Rng_Next = 0;
+    Rng_Miss = 0;
+    Rng_Init = 0;
+    Rng_Distance = -1.0f;
+    Rng_Rate = 0;
+}
+
+// 窗口中值 (插入排序副本，样本数<=RANGING_WINDOW)
+static float ranging_median(void)
+{
+    float buf[RANGING_WINDOW];
+    uint8_t i, j;
+    float v;
+
+    for (i = 0; i < Rng_Count; i++)
+    {
+        v = Rng_Window[i];
+        for (j = i; j > 0 && buf[j - 1] > v; j--)
+            buf[j] = buf[j - 1];
+        buf[j] = v;
+    }
+    return buf[Rng_Count / 2];
+}
+
+// 输入一次测量结果 (Ultrasound_GetLatest()的值)
+// periods: 距上一次输入经过的测量周期数 (序号差)，一般为1
+void Ranging_Update(float raw, uint32_t periods)
+{
+    float dt, z, r;
+
+    if (raw < 0)
+    {
+        // 没有回波起始：传感器故障或未连接，保持上一次结果，连续多次后输出无效
+        if (Rng_Miss < RANGING_MAX_MISS)
+            Rng_Miss++;
+        if (Rng_Miss >= RANGING_MAX_MISS)
+            Ranging_Reset();
+        return;
+    }
+    Rng_Miss = 0;
+
+    if (raw > RANGING_MAX_CM)
+        raw = RANGING_MAX_CM;
+    Rng_Window[Rng_Next] = raw;
+    Rng_Next = (Rng_Next + 1) % RANGING_WINDOW;
+    if (Rng_Count < RANGING_WINDOW)
+        Rng_Count++;
+    z = ranging_median();
+
+    if (periods == 0)
+        periods = 1;
+    dt = periods * (ULTRA_PERIOD / 1000000.0f);
+
+    if (!Rng_Init)
+    {
+        Rng_Init = 1;
+        Rng_Distance = z;
+        Rng_Rate = 0;
+        return;
+    }
+
+    // 预测 -> 残差修正
+    Rng_Distance += Rng_Rate * dt;
+    r = z - Rng_Distance;
+    if (r > RANGING_GATE_CM || r < -RANGING_GATE_CM)
+    {
+        // 转向后换了目标，不把跳变当成速度
+        Rng_Distance = z;
+        Rng_Rate = 0;
+        return;
+    }
+    Rng_Distance += RANGING_ALPHA * r;
+    Rng_Rate += RANGING_BETA * r / dt;
+    if (Rng_Distance < 0)
+        Rng_Distance = 0;
+}
+
+// 滤波后的距离 (cm)，补偿中值滤波的滞后，-1表示无效
+float Ranging_GetDistance(void)
+{
+    float d;
+
+    if (!Rng_Init)
+        return -1.0f;
+    d = Rng_Distance + Rng_Rate * RANGING_DELAY_S;
+    return d > 0 ? d : 0;
+}
+
+// 接近速度 (cm/s)，远离时为负
+float Ranging_GetClosing(void)
+{
+    return -Rng_Rate;
+}
+
+// 是否需要停车：距离不超过min_distance，或按当前接近速度ttc秒内到达min_distance
+uint8_t Ranging_ShouldStop(float min_distance, float ttc)
+{
+    float closing = -Rng_Rate;
+    float d = Ranging_GetDistance();
+
+    if (!Rng_Init)
+        return 0;
+    if (d <= min_distance)
+        return 1;
+    return closing > RANGING_MIN_CLOSING && d - min_distance <= closing * ttc;
+}
@@ -0,0 +1,20 @@
+#ifndef __RANGING_H
+#define __RANGING_H
+
+#include "stm32f10x.h"
+
+#define RANGING_WINDOW 5           // 中值滤波窗口 (测量次数，奇数)
+#define RANGING_MAX_CM 400.0f      // 超出量程 (999) 按此距离参与滤波
+#define RANGING_ALPHA 0.6f         // alpha-beta滤波：距离修正系数
+#define RANGING_BETA 0.2f          // alpha-beta滤波：速度修正系数
+#define RANGING_GATE_CM 30.0f      // 中值跳变超过此值视为换了目标，滤波器重新初始化
+#define RANGING_MAX_MISS 3         // 连续无回波 (-1) 超过此次数输出无效
+#define RANGING_MIN_CLOSING 2.0f   // 接近速度低于此值 (cm/s) 不按碰撞时间判断
+
+void Ranging_Reset(void);
+void Ranging_Update(float raw, uint32_t periods);
+float Ranging_GetDistance(void);
+float Ranging_GetClosing(void);
+uint8_t Ranging_ShouldStop(float min_distance, float ttc);
+
+#endif
@@ -0,0 +1,72 @@
+#include "Scheduler.h"
+
+/*
+ * 协作式定周期调度器：
+ * 每个任务按自己的周期释放，到期后在主循环中执行一次 (运行到完成，不抢占)。
+ * 任务表的顺序即优先级，同一轮中靠前的任务先执行。
+ * 时间来源由Scheduler_Init传入 (板上为micros)，可替换为虚拟时钟。
+ */
+
+static Scheduler_Task *Sched_Tasks = 0;
+static uint8_t Sched_Count = 0;
+static uint32_t (*Sched_Clock)(void) = 0;
+
+// 初始化调度器，所有任务从当前时刻开始释放
+void Scheduler_Init(Scheduler_Task *tasks, uint8_t count, uint32_t (*clock)(void))
+{
+    uint8_t i;
+    uint32_t now = clock();
+
+    Sched_Tasks = tasks;
+    Sched_Count = count;
+    Sched_Clock = clock;
+
+    for (i = 0; i < count; i++)
+    {
+        tasks[i].NextRun = now;
+    }
+    Scheduler_ResetStats();
+}
+
+// 执行一轮调度：依次运行所有已到期的任务
+void Scheduler_Dispatch(void)
+{
+    uint8_t i;
+    uint32_t start, end;
+    Scheduler_Task *t;
+
+    for (i = 0; i < Sched_Count; i++)
+    {
+        t = &Sched_Tasks[i];
+        start = Sched_Clock();
+        if ((int32_t)(start - t->NextRun) < 0)
+            continue; // 未到期
+
+        t->Func();
+        end = Sched_Clock();
+
+        t->RunCount++;
+        if (end - start > t->WCET)
+            t->WCET = end - start;
+
+        // 截止时间即下一次释放时刻；错过时计一次超时并重新对齐，不补跑
+        t->NextRun += t->Period;
+        if ((int32_t)(end - t->NextRun) > 0)
+        {
+            t->Overrun++;
+            t->NextRun = end;
+        }
+    }
+}
+
+// 清零各任务的统计数据
+void Scheduler_ResetStats(void)
+{
+    uint8_t i;
+    for (i = 0; i < Sched_Count; i++)
+    {
+        Sched_Tasks[i].RunCount = 0;
+        Sched_Tasks[i].Overrun = 0;
+        Sched_Tasks[i].WCET = 0;
+    }
+}
@@ -0,0 +1,24 @@
+#ifndef __SCHEDULER_H
+#define __SCHEDULER_H
+
+#include "stm32f10x.h"
+
+// 周期任务描述
+typedef struct
+{
+    const char *Name;    // 任务名 (调试用)
+    void (*Func)(void);  // 任务函数，必须执行完立即返回
+    uint32_t Period;     // 周期 (us)
+    uint32_t NextRun;    // 下次释放时刻 (us)
+    uint32_t RunCount;   // 已执行次数
+    uint32_t Overrun;    // 超时次数：执行结束时已错过下一次释放
+    uint32_t WCET;       // 最坏执行时间 (us)
+} Scheduler_Task;
+
+#define SCHEDULER_TASK(name, func, period_us) {name, func, period_us, 0, 0, 0, 0}
+
+void Scheduler_Init(Scheduler_Task *tasks, uint8_t count, uint32_t (*clock)(void));
+void Scheduler_Dispatch(void);
+void Scheduler_ResetStats(void);
+
+#endif
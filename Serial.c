@@ -0,0 +1,244 @@
+#include "Serial.h"
+#include "Format.h"
+
+/*
+ * 发送：数据先写入环形缓冲区，由DMA1通道4 (USART1_TX) 在后台搬运。
+ * Serial_Write()只拷贝数据、必要时启动DMA，不等待发送完成，可在中断中调用。
+ * 缓冲区放不下时整包丢弃并计数，不会阻塞。
+ *
+ * Tx_Head: 下一个写入位置 (Serial_Write)
+ * Tx_Tail: DMA正在发送/下一次发送的起始位置
+ * Tx_DmaLen: 本次DMA传输的字节数，0表示DMA空闲
+ * DMA传输完成后Tail前移，若还有数据则继续发送下一段连续区域。
+ *
+ * 接收：USART1_IRQHandler把收到的字节写入接收环形缓冲区，主循环用Serial_Read()取出。
+ * 单生产者(中断只写Rx_Head)/单消费者(主循环只写Rx_Tail)，无需关中断。
+ */
+
+static uint8_t Tx_Buf[SERIAL_TX_SIZE];
+static volatile uint16_t Tx_Head = 0;
+static volatile uint16_t Tx_Tail = 0;
+static volatile uint16_t Tx_DmaLen = 0;
+static volatile uint32_t Tx_Dropped = 0; // 因缓冲区满被丢弃的字节数
+
+#define TX_USED() ((uint16_t)((Tx_Head - Tx_Tail) & (SERIAL_TX_SIZE - 1)))
+
+static uint8_t Rx_Buf[SERIAL_RX_SIZE];
+static volatile uint8_t Rx_Head = 0;
+static volatile uint8_t Rx_Tail = 0;
+static volatile uint32_t Rx_Overrun = 0; // 缓冲区满或硬件溢出丢失的字节数
+
+void Serial_Init(void)
+{
+    GPIO_InitTypeDef GPIO_InitStructure;
+    USART_InitTypeDef USART_InitStructure;
+    DMA_InitTypeDef DMA_InitStructure;
+    NVIC_InitTypeDef NVIC_InitStructure;
+
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_USART1 | RCC_APB2Periph_GPIOA, ENABLE);
+    RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+
+    // TX (PA9) -> 复用推挽输出
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF_PP;
+    GPIO_InitStructure.GPIO_Pin = GPIO_Pin_9;
+    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
+    GPIO_Init(GPIOA, &GPIO_InitStructure);
+
+    // RX (PA10) -> 上拉输入
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IPU;
+    GPIO_InitStructure.GPIO_Pin = GPIO_Pin_10;
+    GPIO_Init(GPIOA, &GPIO_InitStructure);
+
+    USART_InitStructure.USART_BaudRate = SERIAL_BAUDRATE;
+    USART_InitStructure.USART_HardwareFlowControl = USART_HardwareFlowControl_None;
+    USART_InitStructure.USART_Mode = USART_Mode_Tx | USART_Mode_Rx;
+    USART_InitStructure.USART_Parity = USART_Parity_No;
+    USART_InitStructure.USART_StopBits = USART_StopBits_1;
+    USART_InitStructure.USART_WordLength = USART_WordLength_8b;
+    USART_Init(USART1, &USART_InitStructure);
+
+    // DMA1通道4：内存 -> USART1->DR，每次传输的地址和长度在启动时填写
+    DMA_DeInit(DMA1_Channel4);
+    DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&USART1->DR;
+    DMA_InitStructure.DMA_MemoryBaseAddr = (uint32_t)Tx_Buf;
+    DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralDST;
+    DMA_InitStructure.DMA_BufferSize = 1;
+    DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+    DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+    DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+    DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+    DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+    DMA_InitStructure.DMA_Priority = DMA_Priority_Medium;
+    DMA_InitStructure.DMA_M2M = DMA_M2M_Disable;
+    DMA_Init(DMA1_Channel4, &DMA_InitStructure);
+    DMA_ITConfig(DMA1_Channel4, DMA_IT_TC, ENABLE);
+
+    // 发送完成中断优先级最低，只做指针推进
+    NVIC_InitStructure.NVIC_IRQChannel = DMA1_Channel4_IRQn;
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 3;
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+    NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStructure);
+
+    NVIC_InitStructure.NVIC_IRQChannel = USART1_IRQn;
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 3;
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 1;
+    NVIC_Init(&NVIC_InitStructure);
+    USART_ITConfig(USART1, USART_IT_RXNE, ENABLE);
+
+    USART_DMACmd(USART1, USART_DMAReq_Tx, ENABLE);
+    USART_Cmd(USART1, ENABLE);
+}
+
+// DMA空闲且有数据时，启动一次发送 (需在临界区或DMA中断中调用)
+static void Serial_TxKick(void)
+{
+    uint16_t len;
+
+    if (Tx_DmaLen != 0 || Tx_Head == Tx_Tail)
+        return;
+
+    // 只发送到缓冲区末尾为止的连续部分，回绕部分下次再发
+    if (Tx_Head > Tx_Tail)
+        len = Tx_Head - Tx_Tail;
+    else
+        len = SERIAL_TX_SIZE - Tx_Tail;
+
+    Tx_DmaLen = len;
+    DMA1_Channel4->CCR &= ~DMA_CCR4_EN;
+    DMA1_Channel4->CMAR = (uint32_t)&Tx_Buf[Tx_Tail];
+    DMA1_Channel4->CNDTR = len;
+    DMA1_Channel4->CCR |= DMA_CCR4_EN;
+}
+
+// 写入发送缓冲区 (不阻塞)，返回1成功；空间不足时整包丢弃并返回0
+uint8_t Serial_Write(const uint8_t *data, uint16_t len)
+{
+    uint32_t primask;
+    uint16_t i, head;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    if (len > SERIAL_TX_SIZE - 1 - TX_USED())
+    {
+        Tx_Dropped += len;
+        __set_PRIMASK(primask);
+        return 0;
+    }
+
+    head = Tx_Head;
+    for (i = 0; i < len; i++)
+    {
+        Tx_Buf[head] = data[i];
+        head = (head + 1) & (SERIAL_TX_SIZE - 1);
+    }
+    Tx_Head = head;
+    Serial_TxKick();
+
+    __set_PRIMASK(primask);
+    return 1;
+}
+
+// 发送缓冲区剩余空间
+uint16_t Serial_TxFree(void)
+{
+    return SERIAL_TX_SIZE - 1 - TX_USED();
+}
+
+// 累计丢弃的字节数
+uint32_t Serial_GetDropped(void)
+{
+    return Tx_Dropped;
+}
+
+// 从接收缓冲区取一个字节，返回0表示缓冲区为空
+uint8_t Serial_Read(uint8_t *byte)
+{
+    uint8_t tail = Rx_Tail;
+
+    if (tail == Rx_Head)
+        return 0;
+    *byte = Rx_Buf[tail];
+    Rx_Tail = (tail + 1) & (SERIAL_RX_SIZE - 1);
+    return 1;
+}
+
+// 累计丢失的接收字节数
+uint32_t Serial_GetRxOverrun(void)
+{
+    return Rx_Overrun;
+}
+
+void Serial_SendByte(uint8_t Byte)
+{
+    Serial_Write(&Byte, 1);
+}
+
+void Serial_SendArray(uint8_t *Array, uint16_t Length)
+{
+    Serial_Write(Array, Length);
+}
+
+void Serial_SendString(char *String)
+{
+    uint16_t len = 0;
+    while (String[len] != 0)
+    {
+        len++;
+    }
+    Serial_Write((const uint8_t *)String, len);
+}
+
+void Serial_SendNumber(uint32_t Number, uint8_t Length)
+{
+    char Digits[FORMAT_DEC_MAX];
+    uint8_t i;
+
+    // 超过10位的部分只可能是前导0
+    for (; Length > FORMAT_DEC_MAX; Length--)
+    {
+        Serial_SendByte('0');
+    }
+    Format_Dec(Digits, Number, Length);
+    for (i = 0; i < Length; i++)
+    {
+        Serial_SendByte(Digits[i]);
+    }
+}
+
+// 一段DMA传输完成：释放已发送的数据，继续发送剩余部分
+void DMA1_Channel4_IRQHandler(void)
+{
+    if (DMA_GetITStatus(DMA1_IT_TC4) == SET)
+    {
+        DMA_ClearITPendingBit(DMA1_IT_TC4);
+        Tx_Tail = (Tx_Tail + Tx_DmaLen) & (SERIAL_TX_SIZE - 1);
+        Tx_DmaLen = 0;
+        Serial_TxKick();
+    }
+}
+
+// 接收中断：写入接收环形缓冲区
+void USART1_IRQHandler(void)
+{
+    uint8_t data, head;
+
+    // 先读SR再读DR，同时清除RXNE和ORE
+    if (USART_GetFlagStatus(USART1, USART_FLAG_ORE) == SET)
+        Rx_Overrun++;
+    if (USART_GetITStatus(USART1, USART_IT_RXNE) == SET || USART_GetFlagStatus(USART1, USART_FLAG_ORE) == SET)
+    {
+        data = (uint8_t)USART_ReceiveData(USART1);
+        head = Rx_Head;
+        if (((head + 1) & (SERIAL_RX_SIZE - 1)) == Rx_Tail)
+        {
+            Rx_Overrun++;
+        }
+        else
+        {
+            Rx_Buf[head] = data;
+            Rx_Head = (head + 1) & (SERIAL_RX_SIZE - 1);
+        }
+    }
+}
@@ -0,0 +1,24 @@
+#ifndef __SERIAL_H
+#define __SERIAL_H
+
+#include "stm32f10x.h"
+
+// USART1: PA9 (TX) / PA10 (RX)，115200 8N1
+// 注意：PA9与RED4共用，启用串口后RED4不可用，IRSensor_Snapshot()中RED4位恒为0
+#define SERIAL_BAUDRATE 115200
+#define SERIAL_TX_SIZE 256 // 发送环形缓冲区大小，必须为2的幂
+#define SERIAL_RX_SIZE 256 // 接收环形缓冲区大小，必须为2的幂且不超过256 (8位下标)；
+                           // 满速115200bps时可容纳22ms的输入，大于cmd任务周期
+
+void Serial_Init(void);
+uint8_t Serial_Write(const uint8_t *data, uint16_t len);
+uint16_t Serial_TxFree(void);
+uint32_t Serial_GetDropped(void);
+uint8_t Serial_Read(uint8_t *byte);
+uint32_t Serial_GetRxOverrun(void);
+void Serial_SendByte(uint8_t Byte);
+void Serial_SendArray(uint8_t *Array, uint16_t Length);
+void Serial_SendString(char *String);
+void Serial_SendNumber(uint32_t Number, uint8_t Length);
+
+#endif
@@ -0,0 +1,193 @@
+#include "Telemetry.h"
+#include "Serial.h"
+#include "Encoder.h"
+#include "motor.h"
+#include "delay.h"
+
+#define TLM_HEADER_LEN 6
+#define TLM_RAW_LEN (TLM_HEADER_LEN + TLM_MAX_PAYLOAD + 4)
+// COBS每254字节最多增加1字节，另加结尾0x00
+#define TLM_FRAME_LEN (TLM_RAW_LEN + TLM_RAW_LEN / 254 + 2)
+
+static uint8_t Tlm_Seq = 0;
+
+// 小端写入
+static void put16(uint8_t *p, uint16_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+// COBS编码，返回编码后长度 (不含结尾0x00)
+static uint16_t cobs_encode(const uint8_t *src, uint16_t len, uint8_t *dst)
+{
+    uint16_t code_pos = 0;
+    uint16_t out = 1;
+    uint8_t code = 1;
+    uint16_t i;
+
+    for (i = 0; i < len; i++)
+    {
+        if (src[i] == 0)
+        {
+            dst[code_pos] = code;
+            code_pos = out++;
+            code = 1;
+        }
+        else
+        {
+            dst[out++] = src[i];
+            if (++code == 0xFF)
+            {
+                dst[code_pos] = code;
+                code_pos = out++;
+                code = 1;
+            }
+        }
+    }
+    dst[code_pos] = code;
+    return out;
+}
+
+void Telemetry_Init(void)
+{
+    RCC_AHBPeriphClockCmd(RCC_AHBPeriph_CRC, ENABLE);
+}
+
+// 组帧并写入串口发送缓冲区，返回0表示缓冲区满被丢弃
+// CRC单元为共享资源，只能在主循环中调用
+uint8_t Telemetry_Send(uint8_t type, const uint8_t *payload, uint8_t len)
+{
+    uint32_t raw_words[(TLM_RAW_LEN + 3) / 4];
+    uint8_t *raw = (uint8_t *)raw_words;
+    uint8_t frame[TLM_FRAME_LEN];
+    uint16_t n, i;
+    uint32_t crc;
+
+    if (len > TLM_MAX_PAYLOAD)
+        return 0;
+
+    raw[0] = type;
+    raw[1] = Tlm_Seq++;
+    put32(raw + 2, micros());
+    for (i = 0; i < len; i++)
+    {
+        raw[TLM_HEADER_LEN + i] = payload[i];
+    }
+    n = TLM_HEADER_LEN + len;
+
+    // 补0到4字节整数倍后按字计算CRC
+    for (i = n; i & 3; i++)
+    {
+        raw[i] = 0;
+    }
+    CRC_ResetDR();
+    crc = CRC_CalcBlockCRC(raw_words, i / 4);
+    put32(raw + n, crc);
+    n += 4;
+
+    n = cobs_encode(raw, n, frame);
+    frame[n++] = 0x00;
+    return Serial_Write(frame, n);
+}
+
+// 编码器计数和实测速度
+void Telemetry_SendEncoder(void)
+{
+    uint8_t buf[12];
+
+    put32(buf, (uint32_t)Encoder_GetLeft());
+    put32(buf + 4, (uint32_t)Encoder_GetRight());
+    put16(buf + 8, (uint16_t)(int16_t)(Motor_GetLeftSpeed() * 100.0f));
+    put16(buf + 10, (uint16_t)(int16_t)(Motor_GetRightSpeed() * 100.0f));
+    Telemetry_Send(TLM_ENCODER, buf, sizeof(buf));
+}
+
+// 两轮速度环PID各项
+void Telemetry_SendPid(void)
+{
+    uint8_t buf[MOTOR_PID_STATE_NUM * 4];
+    int16_t state[MOTOR_PID_STATE_NUM];
+    uint8_t wheel, i;
+
+    for (wheel = 0; wheel < 2; wheel++)
+    {
+        Motor_GetPidState(wheel, state);
+        for (i = 0; i < MOTOR_PID_STATE_NUM; i++)
+        {
+            put16(buf + (wheel * MOTOR_PID_STATE_NUM + i) * 2, (uint16_t)state[i]);
+        }
+    }
+    Telemetry_Send(TLM_PID, buf, sizeof(buf));
+}
+
+// 红外掩码、超声波距离和当前动作
+void Telemetry_SendSensor(uint8_t ir_mask, float distance, uint8_t op)
+{
+    uint8_t buf[4];
+
+    buf[0] = ir_mask;
+    put16(buf + 1, (uint16_t)(int16_t)(distance * 10.0f));
+    buf[3] = op;
+    Telemetry_Send(TLM_SENSOR, buf, sizeof(buf));
+}
+
+// 耗时统计：区域号，名称 (8字节，不足补0)，次数，最小/最大/平均周期数
+void Telemetry_SendProfile(uint8_t id, const Profile_Region *r)
+{
+    uint8_t buf[25];
+    uint8_t i;
+
+    buf[0] = id;
+    for (i = 0; i < 8; i++)
+    {
+        buf[1 + i] = r->Name[i];
+        if (r->Name[i] == 0)
+            break;
+    }
+    for (; i < 8; i++)
+    {
+        buf[1 + i] = 0;
+    }
+    put32(buf + 9, r->Count);
+    put32(buf + 13, r->Min);
+    put32(buf + 17, r->Max);
+    put32(buf + 21, Profile_Mean(r));
+    Telemetry_Send(TLM_PROFILE, buf, sizeof(buf));
+}
+
+// 时间直方图
+void Telemetry_SendHist(uint8_t id, const Latency_Hist *h)
+{
+    uint8_t buf[9 + 2 * LATENCY_BINS];
+    uint8_t i;
+
+    buf[0] = id;
+    put32(buf + 1, h->Count);
+    put32(buf + 5, h->Max);
+    for (i = 0; i < LATENCY_BINS; i++)
+    {
+        put16(buf + 9 + 2 * i, h->Bins[i]);
+    }
+    Telemetry_Send(TLM_HIST, buf, sizeof(buf));
+}
+
+// 文本应答，超出单帧长度的部分截断
+void Telemetry_SendText(const char *text)
+{
+    uint8_t len = 0;
+
+    while (text[len] != 0 && len < TLM_MAX_PAYLOAD)
+    {
+        len++;
+    }
+    Telemetry_Send(TLM_TEXT, (const uint8_t *)text, len);
+}
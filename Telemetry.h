@@ -0,0 +1,35 @@
+#ifndef __TELEMETRY_H
+#define __TELEMETRY_H
+
+#include "stm32f10x.h"
+#include "Profile.h"
+#include "Latency.h"
+
+/*
+ * 二进制遥测帧 (COBS编码后以0x00结尾)：
+ *   类型(1) 序号(1) 时间戳us(4) 负载(N) CRC32(4)
+ * 多字节字段均为小端。CRC由片上CRC单元计算，范围为类型到负载末尾，
+ * 不足4字节整数倍时补0 (补的0不发送)。
+ * 解码工具见 tools/telemetry_decode.py
+ */
+
+#define TLM_MAX_PAYLOAD 64
+
+// 帧类型
+#define TLM_ENCODER 1 // 左/右累计计数 int32，左/右实测速度 int16 (0.01%)
+#define TLM_PID 2     // 左/右轮各6个int16 (0.01)：目标、实测、误差、积分、微分、输出
+#define TLM_SENSOR 3  // 红外掩码 uint8，超声波距离 int16 (0.1cm)，当前动作 uint8
+#define TLM_TEXT 4    // ASCII文本 (命令应答)，不含结尾0
+#define TLM_PROFILE 5 // 耗时统计 (见Profile.h)：区域号 uint8，名称 char[8]，次数/最小/最大/平均周期 uint32
+#define TLM_HIST 6    // 时间直方图 (见Latency.h)：编号 uint8，次数/最大值us uint32，各档次数 uint16[LATENCY_BINS]
+
+void Telemetry_Init(void);
+uint8_t Telemetry_Send(uint8_t type, const uint8_t *payload, uint8_t len);
+void Telemetry_SendEncoder(void);
+void Telemetry_SendPid(void);
+void Telemetry_SendSensor(uint8_t ir_mask, float distance, uint8_t op);
+void Telemetry_SendProfile(uint8_t id, const Profile_Region *r);
+void Telemetry_SendHist(uint8_t id, const Latency_Hist *h);
+void Telemetry_SendText(const char *text);
+
+#endif
@@ -1,24 +1,48 @@
 #include "stm32f10x.h" // Device header
 #include "Ultrasound.h"
-#include "Delay.h"
+#include "Profile.h"
 
 #define ULTRA_PORT GPIOB
 #define ULTRA_TRIG_PIN GPIO_Pin_0
 #define ULTRA_ECHO_PIN GPIO_Pin_1
 
-// 超时阈值，防止while死循环 (约20ms)
+// TRIG高电平宽度 (us)，模块要求至少10us
+#define ULTRA_TRIG_WIDTH 20
+// 回波超时阈值 (约20ms)，超过视为超出量程
 #define MAX_TIMEOUT 20000
 
-uint16_t Cnt;
-uint16_t OverCnt;
-
+// 测量状态
+#define ULTRA_WAIT_RISE 0 // 已触发，等待ECHO上升沿
+#define ULTRA_WAIT_FALL 1 // 已捕获上升沿，等待ECHO下降沿
+#define ULTRA_DONE      2 // 本周期测量完成
+
+static volatile uint8_t Ultra_State = ULTRA_DONE;
+static volatile uint16_t Ultra_RiseCnt;        // 上升沿时刻的TIM1计数值
+static volatile float Ultra_Distance = -1.0f;  // 最近一次测量结果 (cm)
+static volatile uint32_t Ultra_Seq = 0;        // 测量结果序号，每发布一次加1
+
+/*
+ * 测距引擎：
+ * TIM1以1us计数、60ms为周期自由运行。
+ * - 更新中断：结算上一周期的结果，拉高TRIG并开始新一次测量
+ * - CC1比较中断 (CNT=20)：拉低TRIG，完成触发脉冲
+ * - EXTI1 (PB1双边沿)：在上升沿/下降沿锁存TIM1计数值，差值即为回波宽度
+ * 主循环只需调用Ultrasound_GetLatest()读取结果，不再阻塞等待回波。
+ *
+ * 注：PB1不是TIM1的输入捕获通道 (TIM3_CH4又被编码器占用)，
+ * 因此用EXTI边沿中断锁存TIM1计数值实现捕获，误差为中断响应时间 (<1us)。
+ */
 void Ultrasound_Init(void)
 {
     GPIO_InitTypeDef GPIO_InitStructure;
     TIM_TimeBaseInitTypeDef TIM_TimeBaseInitStructure;
+    TIM_OCInitTypeDef TIM_OCInitStructure;
+    EXTI_InitTypeDef EXTI_InitStructure;
+    NVIC_InitTypeDef NVIC_InitStructure;
 
     // 开启时钟
     RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOB, ENABLE);
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_AFIO, ENABLE);
     RCC_APB2PeriphClockCmd(RCC_APB2Periph_TIM1, ENABLE);
 
     // TRIG (PB0) -> 推挽输出
@@ -32,61 +56,158 @@ void Ultrasound_Init(void)
     GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IPD;
     GPIO_Init(ULTRA_PORT, &GPIO_InitStructure);
 
-    // 定时器初始化 (1us计数一次)
-    TIM_TimeBaseInitStructure.TIM_Period = 59999;
+    // 默认拉低TRIG
+    GPIO_ResetBits(ULTRA_PORT, ULTRA_TRIG_PIN);
+
+    // ECHO双边沿中断
+    GPIO_EXTILineConfig(GPIO_PortSourceGPIOB, GPIO_PinSource1);
+    EXTI_InitStructure.EXTI_Line = EXTI_Line1;
+    EXTI_InitStructure.EXTI_Mode = EXTI_Mode_Interrupt;
+    EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Rising_Falling;
+    EXTI_InitStructure.EXTI_LineCmd = ENABLE;
+    EXTI_Init(&EXTI_InitStructure);
+
+    // 定时器初始化 (1us计数一次，60ms一个测量周期)
+    TIM_TimeBaseInitStructure.TIM_Period = ULTRA_PERIOD - 1;
     TIM_TimeBaseInitStructure.TIM_Prescaler = 71; // 72MHz/72 = 1MHz
     TIM_TimeBaseInitStructure.TIM_ClockDivision = TIM_CKD_DIV1;
     TIM_TimeBaseInitStructure.TIM_CounterMode = TIM_CounterMode_Up;
+    TIM_TimeBaseInitStructure.TIM_RepetitionCounter = 0;
     TIM_TimeBaseInit(TIM1, &TIM_TimeBaseInitStructure);
 
-    // 默认拉低TRIG
-    GPIO_ResetBits(ULTRA_PORT, ULTRA_TRIG_PIN);
+    // CC1仅用作定时比较 (不输出到引脚)，到点结束TRIG脉冲
+    TIM_OCStructInit(&TIM_OCInitStructure);
+    TIM_OCInitStructure.TIM_OCMode = TIM_OCMode_Timing;
+    TIM_OCInitStructure.TIM_Pulse = ULTRA_TRIG_WIDTH;
+    TIM_OC1Init(TIM1, &TIM_OCInitStructure);
+
+    TIM_ClearFlag(TIM1, TIM_FLAG_Update | TIM_FLAG_CC1);
+    TIM_ITConfig(TIM1, TIM_IT_Update | TIM_IT_CC1, ENABLE);
+
+    // 回波边沿优先级最高，保证计数值锁存及时
+    NVIC_InitStructure.NVIC_IRQChannel = EXTI1_IRQn;
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0;
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+    NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStructure);
+
+    NVIC_InitStructure.NVIC_IRQChannel = TIM1_UP_IRQn;
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 1;
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 1;
+    NVIC_Init(&NVIC_InitStructure);
+
+    NVIC_InitStructure.NVIC_IRQChannel = TIM1_CC_IRQn;
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 1;
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+    NVIC_Init(&NVIC_InitStructure);
+
+    // 启动后第一次溢出时发起首次测量
+    TIM_SetCounter(TIM1, 0);
+    TIM_Cmd(TIM1, ENABLE);
 }
 
-float Test_Distance(void)
+// 发布一次测量结果
+static void Ultrasound_Publish(float distance)
 {
-    uint32_t timeout = 0;
+    Ultra_Distance = distance;
+    Ultra_Seq++;
+    Ultra_State = ULTRA_DONE;
+}
 
-    // 1. 发送至少10us的高电平触发信号
-    GPIO_SetBits(ULTRA_PORT, ULTRA_TRIG_PIN);
-    Delay_us(20);
-    GPIO_ResetBits(ULTRA_PORT, ULTRA_TRIG_PIN);
+// 回波宽度 (us) 转距离 (cm)
+// 距离(cm) = 时间(us) * 340m/s / 2 / 10000
+//         = count * 0.017
+float Ultrasound_WidthToDistance(uint16_t width_us)
+{
+    if (width_us > MAX_TIMEOUT)
+        return 999.0f; // 超出最大量程
+    return (float)width_us * 0.017f;
+}
 
-    // 2. 等待 ECHO 变高 (开始发送波)
-    timeout = 0;
-    while (GPIO_ReadInputDataBit(ULTRA_PORT, ULTRA_ECHO_PIN) == RESET)
-    {
-        timeout++;
-        if (timeout > MAX_TIMEOUT)
-            return -1.0; // 超时，传感器未连接或损坏
-        Delay_us(1);
-    }
+// 获取最近一次测量结果 (cm)，不阻塞
+// -1.0: 未检测到回波起始 (传感器未连接或损坏) / 尚无测量结果
+// 999.0: 回波超时 (超出最大量程)
+float Ultrasound_GetLatest(void)
+{
+    return Ultra_Distance;
+}
 
-    // 3. 开始计时
-    TIM_SetCounter(TIM1, 0);
-    TIM_Cmd(TIM1, ENABLE);
+// 获取测量结果序号，序号变化表示有新数据
+uint32_t Ultrasound_GetSeq(void)
+{
+    return Ultra_Seq;
+}
+
+// 同时读取序号和对应的测量结果 (关中断，避免两次读取之间发布了新结果)，返回序号
+uint32_t Ultrasound_Read(float *distance)
+{
+    uint32_t seq;
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    seq = Ultra_Seq;
+    *distance = Ultra_Distance;
+    __set_PRIMASK(primask);
+    return seq;
+}
+
+// 兼容旧接口：直接返回最近一次测量结果，不再忙等回波
+float Test_Distance(void)
+{
+    return Ultrasound_GetLatest();
+}
 
-    // 4. 等待 ECHO 变低 (收到回波)
-    timeout = 0;
-    while (GPIO_ReadInputDataBit(ULTRA_PORT, ULTRA_ECHO_PIN) == SET)
+// 测量周期开始：结算上一周期并发出新的触发脉冲
+void TIM1_UP_IRQHandler(void)
+{
+    if (TIM_GetITStatus(TIM1, TIM_IT_Update) == SET)
     {
-        timeout++;
-        if (timeout > MAX_TIMEOUT) // 超时 (超出最大量程)
+        if (Ultra_State == ULTRA_WAIT_RISE)
+        {
+            Ultrasound_Publish(-1.0f); // 整个周期未等到回波起始
+        }
+        else if (Ultra_State == ULTRA_WAIT_FALL)
         {
-            TIM_Cmd(TIM1, DISABLE);
-            return 999.0; // 返回一个大数值表示无穷远
+            Ultrasound_Publish(999.0f); // 回波一直未结束
         }
-        Delay_us(1);
+
+        Ultra_State = ULTRA_WAIT_RISE;
+        GPIO_SetBits(ULTRA_PORT, ULTRA_TRIG_PIN);
+        TIM_ClearITPendingBit(TIM1, TIM_IT_Update);
     }
+}
 
-    // 5. 停止计时并计算
-    TIM_Cmd(TIM1, DISABLE);
-    uint16_t count = TIM_GetCounter(TIM1);
+// 触发脉冲结束
+void TIM1_CC_IRQHandler(void)
+{
+    if (TIM_GetITStatus(TIM1, TIM_IT_CC1) == SET)
+    {
+        GPIO_ResetBits(ULTRA_PORT, ULTRA_TRIG_PIN);
+        TIM_ClearITPendingBit(TIM1, TIM_IT_CC1);
+    }
+}
 
-    // 距离(cm) = 时间(us) * 340m/s / 2 / 10000
-    //         = count * 0.017
-    float distance = (float)count * 0.017f;
+// ECHO边沿：锁存TIM1计数值
+void EXTI1_IRQHandler(void)
+{
+    if (EXTI_GetITStatus(EXTI_Line1) == SET)
+    {
+        uint16_t cnt = TIM_GetCounter(TIM1);
+        uint32_t t = PROFILE_BEGIN();
 
-    Delay_ms(10); // 采样间隔
-    return distance;
-}
\ No newline at end of file
+        if (GPIO_ReadInputDataBit(ULTRA_PORT, ULTRA_ECHO_PIN) == SET)
+        {
+            if (Ultra_State == ULTRA_WAIT_RISE)
+            {
+                Ultra_RiseCnt = cnt;
+                Ultra_State = ULTRA_WAIT_FALL;
+            }
+        }
+        else if (Ultra_State == ULTRA_WAIT_FALL)
+        {
+            Ultrasound_Publish(Ultrasound_WidthToDistance((uint16_t)(cnt - Ultra_RiseCnt)));
+        }
+        EXTI_ClearITPendingBit(EXTI_Line1);
+        PROFILE_END(PROF_ECHO, t);
+    }
+}
@@ -1,5 +1,16 @@
 #ifndef __ULTRASOUND_H
 #define __ULTRASOUND_H
-void Ultrasound_Init();
-float Test_Distance();
-#endif
\ No newline at end of file
+
+#include "stm32f10x.h"
+
+// 测量周期 (us)：TIM1每60ms溢出一次，溢出时自动发起下一次测量
+#define ULTRA_PERIOD 60000
+
+void Ultrasound_Init(void);
+float Ultrasound_GetLatest(void);
+uint32_t Ultrasound_GetSeq(void);
+uint32_t Ultrasound_Read(float *distance);
+float Ultrasound_WidthToDistance(uint16_t width_us);
+float Test_Distance(void);
+
+#endif
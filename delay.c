@@ -1,5 +1,8 @@
 #include "delay.h"
 
+// 系统运行毫秒数，由SysTick_Handler每1ms加1
+static volatile uint32_t sys_ms = 0;
+
 void delay_init()
 {
     // 选择外部时钟  HCLK/8
@@ -12,19 +15,66 @@ void delay_init()
 
     // 1ms震动次数 = 1us震动次数 * 1000
     fac_ms = (uint16_t)fac_us * 1000;
+
+    // SysTick作为1ms时基一直运行，不再被延时函数改写
+    SysTick->LOAD = fac_ms - 1;
+    SysTick->VAL = 0x00;
+    // SysTick中断还承担1kHz电机控制，优先级低于测距等外设中断 (分组2下抢占优先级2)
+    NVIC_SetPriority(SysTick_IRQn, 2 << 2);
+    SysTick->CTRL |= SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+}
+
+// 由SysTick_Handler调用
+void Delay_IncTick(void)
+{
+    sys_ms++;
 }
 
+// 上电以来的毫秒数 (约49天回绕)
+uint32_t millis(void)
+{
+    return sys_ms;
+}
+
+// 上电以来的微秒数 (约71分钟回绕)
+uint32_t micros(void)
+{
+    uint32_t ms, val, pend;
+
+    do
+    {
+        ms = sys_ms;
+        val = SysTick->VAL;
+        pend = SCB->ICSR & SCB_ICSR_PENDSTSET_Msk;
+    } while (ms != sys_ms);
+
+    // 在关中断或更高优先级中断中调用时，计数器可能已回绕但中断还没执行
+    if (pend && val > fac_ms / 2)
+        ms++;
+
+    return ms * 1000 + (fac_ms - 1 - val) / fac_us;
+}
+
+// 微秒延时：累计SysTick->VAL的递减量，不改动SysTick配置
 void Delay_us(uint32_t xus)
 {
-    if (xus == 0)
-        return;
-    SysTick->LOAD = 72 * xus - 1;
-    SysTick->VAL = 0x00;
-    SysTick->CTRL = 0x00000005;
-    while (!(SysTick->CTRL & 0x00010000))
-        ;
-    SysTick->CTRL = 0x00000004;
-    SysTick->VAL = 0x00;
+    uint32_t ticks = xus * fac_us;
+    uint32_t reload = SysTick->LOAD + 1;
+    uint32_t told = SysTick->VAL;
+    uint32_t tnow, tcnt = 0;
+
+    while (tcnt < ticks)
+    {
+        tnow = SysTick->VAL;
+        if (tnow != told)
+        {
+            if (tnow < told)
+                tcnt += told - tnow;
+            else
+                tcnt += reload - tnow + told; // 计数器已重装
+            told = tnow;
+        }
+    }
 }
 
 void Delay_ms(uint32_t xms)
@@ -11,5 +11,8 @@ void Delay_us(uint32_t xus);
 void Delay_ms(uint32_t xms);
 void Delay_s(uint32_t xs);
 void delay_init(void);
+void Delay_IncTick(void);
+uint32_t millis(void);
+uint32_t micros(void);
 
 #endif
@@ -1,70 +1,194 @@
-#include "stm32f10x.h"                  // Device header
 #include "PID.h"
 
-// ʽPIDʼ
-void Incremental_PID_Init(PID_TypeDef* pid, float kp, float ki, float kd,
-                         float max_out, float min_out) {
+/*
+ * ͨPID
+ * - λʽu = Kp*e + I + D + Kf*rI += Ki*e + Kaw*(u޷ - u޷ǰ)
+ *   ʱ˻ (back-calculation)˳͸졢С
+ * - ʽu += Kp*(e-e1) + Ki*e + D + Kf*(r-r1)
+ *   ǻ״̬޷ɷֱֹ
+ * ģʽ΢һ׵ͨD += DFilter*(Dԭʼ - D)
+ *
+ * ļǲֿĿ¼PID.cĸ (GBK)̹̲Ŀ¼ɵ롣
+ * ޸ʱͬtests/test_pid_example.c ݸĿ¼ͬĲԡ
+ */
+
+// ޷
+static float pid_limit(float x, float min, float max)
+{
+    if (x > max) return max;
+    if (x < min) return min;
+    return x;
+}
+
+// ģʽΧǰ//΢˲ȡĬֵ״̬
+void PID_Config(PID_TypeDef *pid, uint8_t mode, float kp, float ki, float kd, float out_min, float out_max)
+{
+    pid->Mode = mode;
     pid->Kp = kp;
     pid->Ki = ki;
     pid->Kd = kd;
-    pid->integral = 0;
-    pid->prev_error = 0;
-    pid->prev2_error = 0;
-    pid->output = 0;
-    pid->output_prev = 0;
-    pid->max_output = max_out;
-    pid->min_output = min_out;
-    pid->max_integral = 0;
-    pid->min_integral = 0;
+    pid->Kf = 0;
+    pid->Kaw = 0;
+    pid->DFilter = 1.0f;
+    pid->OutMin = out_min;
+    pid->OutMax = out_max;
+    PID_Reset(pid);
+}
+
+// ״̬ (֡ʷ)治
+void PID_Reset(PID_TypeDef *pid)
+{
+    pid->Target = 0;
+    pid->Actual = 0;
+    pid->Error = 0;
+    pid->LastError = 0;
+    pid->PrevError = 0;
+    pid->Integral = 0;
+    pid->DTerm = 0;
+    pid->Output = 0;
+}
+
+float PID_Calc(PID_TypeDef *pid, float target, float actual)
+{
+    float d_raw, out;
+
+    pid->Error = target - actual;
+
+    if (pid->Mode == PID_INCREMENTAL)
+    {
+        d_raw = pid->Kd * (pid->Error - 2.0f * pid->LastError + pid->PrevError);
+        pid->DTerm += pid->DFilter * (d_raw - pid->DTerm);
+
+        out = pid->Output
+            + pid->Kp * (pid->Error - pid->LastError)
+            + pid->Ki * pid->Error
+            + pid->DTerm
+            + pid->Kf * (target - pid->Target);
+        pid->Output = pid_limit(out, pid->OutMin, pid->OutMax);
+    }
+    else
+    {
+        d_raw = pid->Kd * (pid->Error - pid->LastError);
+        pid->DTerm += pid->DFilter * (d_raw - pid->DTerm);
+
+        out = pid->Kp * pid->Error + pid->Integral + pid->DTerm + pid->Kf * target;
+        pid->Output = pid_limit(out, pid->OutMin, pid->OutMax);
+
+        // 㿹ͣ޷ʱѻ
+        pid->Integral += pid->Ki * pid->Error + pid->Kaw * (pid->Output - out);
+        pid->Integral = pid_limit(pid->Integral, pid->OutMin, pid->OutMax);
+    }
+
+    pid->PrevError = pid->LastError;
+    pid->LastError = pid->Error;
+    pid->Target = target;
+    pid->Actual = actual;
+
+    return pid->Output;
+}
+
+// ================= PID (Q16.16) =================
+
+// 64λм͵32λ
+static q16_t q16_sat(int64_t x)
+{
+    if (x > 0x7FFFFFFF) return 0x7FFFFFFF;
+    if (x < -0x7FFFFFFF - 1) return -0x7FFFFFFF - 1;
+    return (q16_t)x;
+}
 
+// ͼӷ
+static q16_t q16_add(q16_t a, q16_t b)
+{
+    return q16_sat((int64_t)a + b);
+}
+
+// ͼ
+static q16_t q16_sub(q16_t a, q16_t b)
+{
+    return q16_sat((int64_t)a - b);
+}
+
+// ͳ˷ (SMULL16λ)
+static q16_t q16_mul(q16_t a, q16_t b)
+{
+    return q16_sat(((int64_t)a * b) >> 16);
 }
-						 
-// λʽPIDʼ
-void Positional_PID_Init(PID_TypeDef* pid, float kp, float ki, float kd, 
-                        float max_out, float min_out, float max_i, float min_i) {
+
+// ޷
+static q16_t q16_limit(q16_t x, q16_t min, q16_t max)
+{
+    if (x > max) return max;
+    if (x < min) return min;
+    return x;
+}
+
+void PIDQ_Config(PIDQ_TypeDef *pid, uint8_t mode, q16_t kp, q16_t ki, q16_t kd, q16_t out_min, q16_t out_max)
+{
+    pid->Mode = mode;
     pid->Kp = kp;
     pid->Ki = ki;
     pid->Kd = kd;
-    pid->integral = 0;
-    pid->prev_error = 0;
-    pid->output = 0;
-    pid->max_output = max_out;
-    pid->min_output = min_out;
-    pid->max_integral = max_i;
-    pid->min_integral = min_i;
+    pid->Kf = 0;
+    pid->Kaw = 0;
+    pid->DFilter = Q16_ONE;
+    pid->OutMin = out_min;
+    pid->OutMax = out_max;
+    PIDQ_Reset(pid);
 }
-						
-//ʽPID
-float Incremental_PID_Calculate(PID_TypeDef* pid, float setpoint, float feedback)
+
+void PIDQ_Reset(PIDQ_TypeDef *pid)
 {
-	float error, delta_output;
-    
-    // 
-    error = setpoint - feedback;
-    
-    // ʽPID
-    delta_output = pid->Kp * (error - pid->prev_error) +
-                   pid->Ki * error +
-                   pid->Kd * (error - 2 * pid->prev_error + pid->prev2_error);
-    
-    // 㵱ǰ
-    pid->output = pid->output_prev + delta_output;
-    
-    // ޷
-    if (pid->output > pid->max_output)
-	{
-        pid->output = pid->max_output;
-    } 
-	else if (pid->output < pid->min_output) 
-	{
-        pid->output = pid->min_output;
-    }
-    
-    // ¼
-    pid->prev2_error = pid->prev_error;
-    pid->prev_error = error;
-    pid->output_prev = pid->output;
-    
-    return pid->output;
+    pid->Target = 0;
+    pid->Actual = 0;
+    pid->Error = 0;
+    pid->LastError = 0;
+    pid->PrevError = 0;
+    pid->Integral = 0;
+    pid->DTerm = 0;
+    pid->Output = 0;
 }
 
+// PID_Calc()ͬ㷨ȫΪ
+q16_t PIDQ_Calc(PIDQ_TypeDef *pid, q16_t target, q16_t actual)
+{
+    q16_t d_raw, out;
+
+    pid->Error = q16_sub(target, actual);
+
+    if (pid->Mode == PID_INCREMENTAL)
+    {
+        // e - 2*e1 + e2 = (e - e1) - (e1 - e2)
+        d_raw = q16_mul(pid->Kd, q16_sub(q16_sub(pid->Error, pid->LastError),
+                                         q16_sub(pid->LastError, pid->PrevError)));
+        pid->DTerm = q16_add(pid->DTerm, q16_mul(pid->DFilter, q16_sub(d_raw, pid->DTerm)));
+
+        out = q16_add(pid->Output, q16_mul(pid->Kp, q16_sub(pid->Error, pid->LastError)));
+        out = q16_add(out, q16_mul(pid->Ki, pid->Error));
+        out = q16_add(out, pid->DTerm);
+        out = q16_add(out, q16_mul(pid->Kf, q16_sub(target, pid->Target)));
+        pid->Output = q16_limit(out, pid->OutMin, pid->OutMax);
+    }
+    else
+    {
+        d_raw = q16_mul(pid->Kd, q16_sub(pid->Error, pid->LastError));
+        pid->DTerm = q16_add(pid->DTerm, q16_mul(pid->DFilter, q16_sub(d_raw, pid->DTerm)));
+
+        out = q16_add(q16_mul(pid->Kp, pid->Error), pid->Integral);
+        out = q16_add(out, pid->DTerm);
+        out = q16_add(out, q16_mul(pid->Kf, target));
+        pid->Output = q16_limit(out, pid->OutMin, pid->OutMax);
+
+        // 㿹
+        pid->Integral = q16_add(pid->Integral, q16_mul(pid->Ki, pid->Error));
+        pid->Integral = q16_add(pid->Integral, q16_mul(pid->Kaw, q16_sub(pid->Output, out)));
+        pid->Integral = q16_limit(pid->Integral, pid->OutMin, pid->OutMax);
+    }
+
+    pid->PrevError = pid->LastError;
+    pid->LastError = pid->Error;
+    pid->Target = target;
+    pid->Actual = actual;
+
+    return pid->Output;
+}
@@ -2,34 +2,74 @@
 #define __PID_H
 
 #include "stm32f10x.h"
-#include <stdint.h>
+
+// PIDģʽ
+#define PID_POSITIONAL 0  // λʽ = P + I + D + ǰ
+#define PID_INCREMENTAL 1 // ʽ = ϴ + 
 
 // PIDṹ嶨
-typedef struct {
-    float Kp;           // ϵ
-    float Ki;           // ϵ  
-    float Kd;           // ΢ϵ
-    float integral;     // 
-    float prev_error;   // ϴ
-    float prev2_error;  // ϴʽã
-    float output;       // ֵ
-    float output_prev;  // ϴʽã
-    float max_output;   // ޷
-    float min_output;
-    float max_integral; // ޷
-    float min_integral;
-    
-    // ٱأѡ
-    float gear_ratio;
-    uint8_t control_target;
+typedef struct
+{
+    uint8_t Mode; // PID_POSITIONAL / PID_INCREMENTAL
+
+    float Kp; // Proportional gain
+    float Ki; // Integral gain
+    float Kd; // Derivative gain
+    float Kf; // ǰϵ Kf*Target (Ĭ0)
+    float Kaw; // 㿹ϵλʽʹ (Ĭ0)
+    float DFilter; // ΢һ׵ͨϵ 0~1ԽС˲Խǿ (Ĭ1˲)
+    float OutMin; //  (Ϊڷת)
+    float OutMax; // 
+
+    float Target;    // Target value
+    float Actual;    // Actual value
+    float Error;     // Current error
+    float LastError; // Last error
+    float PrevError; // ϴ (ʽ)
+    float Integral;  //  (λʽãѳKi)
+    float DTerm;     // ˲΢
+    float Output;    // PID output value
 } PID_TypeDef;
 
-void Incremental_PID_Init(PID_TypeDef* pid, float kp, float ki, float kd,
-                         float max_out, float min_out);
-void Positional_PID_Init(PID_TypeDef* pid, float kp, float ki, float kd, 
-                        float max_out, float min_out, float max_i, float min_i);
+// 
+void PID_Config(PID_TypeDef *pid, uint8_t mode, float kp, float ki, float kd, float out_min, float out_max);
+void PID_Reset(PID_TypeDef *pid);
+float PID_Calc(PID_TypeDef *pid, float target, float actual);
 
-float Incremental_PID_Calculate(PID_TypeDef* pid, float setpoint, float feedback);
+// ================= PID (Q16.16) =================
+// FPUʱȫ⣬жö汾16λ16λС
+typedef int32_t q16_t;
 
-#endif
+#define Q16_ONE 65536
+#define Q16(x) ((q16_t)((x) * 65536.0f))          // 㳣תQ16.16
+#define Q16_TO_FLOAT(x) ((float)(x) / 65536.0f)   // Q16.16ת (ʾ/)
+
+// ֶκPID_TypeDefͬ㱥Ͳ
+typedef struct
+{
+    uint8_t Mode;
 
+    q16_t Kp;
+    q16_t Ki;
+    q16_t Kd;
+    q16_t Kf;
+    q16_t Kaw;
+    q16_t DFilter;
+    q16_t OutMin;
+    q16_t OutMax;
+
+    q16_t Target;
+    q16_t Actual;
+    q16_t Error;
+    q16_t LastError;
+    q16_t PrevError;
+    q16_t Integral;
+    q16_t DTerm;
+    q16_t Output;
+} PIDQ_TypeDef;
+
+void PIDQ_Config(PIDQ_TypeDef *pid, uint8_t mode, q16_t kp, q16_t ki, q16_t kd, q16_t out_min, q16_t out_max);
+void PIDQ_Reset(PIDQ_TypeDef *pid);
+q16_t PIDQ_Calc(PIDQ_TypeDef *pid, q16_t target, q16_t actual);
+
+#endif
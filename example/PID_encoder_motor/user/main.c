@@ -21,7 +21,7 @@ int main(void)
 	Motor_Init();
 	Timer_Init();
 	target = 300 * 0.2;
-	Incremental_PID_Init(&Inc, 1.0, 0.1, 0.05, 100, -100);//kp,ki,kd,max,min
+	PID_Config(&Inc, PID_INCREMENTAL, 1.0, 0.1, 0.05, -100, 100);//mode,kp,ki,kd,min,max
 	
 	while (1)
 	{
@@ -37,7 +37,7 @@ void TIM2_IRQHandler(void)
 	{
 //		float pulse = Encoder_Get()*0.2;
 		int32_t pulse = Encoder_Get();
-//        float out = Incremental_PID_Calculate(&Inc, target, pulse);
+//        float out = PID_Calc(&Inc, target, pulse);
 //        Motor_SetSpeed(out);
         
         // Ϣ
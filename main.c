@@ -3,21 +3,58 @@
 #include "motor.h"
 #include "IRSensor.h"
 #include "Ultrasound.h"
+#include "Ranging.h"
+#include "Brake.h"
+#include "Encoder.h"
+#include "Avoid.h"
+#include "Scheduler.h"
+#include "Param.h"
+#include "oled.h"
+#include "Serial.h"
+#include "Telemetry.h"
+#include "Command.h"
+#include "Profile.h"
+#include "Latency.h"
 
 // ================= 宏定义参数 =================
-#define STOP_DISTANCE 15.0f    // 超声波停车距离(cm)
-#define WALL_ADJUST_PWM 15.0f  // 巡墙纠偏时增加的PWM值
 #define STRAIGHT_TIMEOUT 12000 // 直行超时时间(ms)
+#define FRONT_CONFIRM_MS 20    // 红外中断停车后等待消抖确认的时间(ms)，约4次红外快照
 
 // ================= 状态变量 =================
+uint8_t ir_mask; // 红外快照掩码
 uint8_t r1, r2, r5, r6;
-float distance;
-uint32_t straight_time = 0; // 直行时间计数器 (ms)
+float distance;  // 滤波后的超声波距离 (cm)，-1无效
+uint32_t ultra_seq = 0; // 已处理的测量序号
+uint8_t front_ir = 0, front_ultra = 0; // 传感器任务看到的前方障碍 (超声波为碰撞时间判断结果)
+uint32_t straight_start = 0; // 直行开始时刻 (ms)
+uint32_t motor_last = 0;     // 上一次电机任务的时刻 (ms)
 uint8_t straight_mode = 0;  // 直行状态标记: 0=非直行, 1=正常直行
+uint8_t front_pending = 0;  // 红外中断锁存了前方边沿，尚未被消抖结果确认
+uint32_t front_pending_at = 0; // 锁存被取走的时刻 (ms)
 
 // ================= 函数声明 =================
 void System_Init_All(void);
-void Check_Straight_Timeout(void);
+void Task_Motor(void);
+void Task_IR(void);
+void Task_Ultrasound(void);
+void Task_Control(void);
+void Task_Display(void);
+void Task_Telemetry(void);
+void Report_Obstacle(void);
+
+// ================= 任务表 (顺序即优先级) =================
+Scheduler_Task Tasks[] = {
+    SCHEDULER_TASK("motor", Task_Motor, 1000),        // 1kHz  动作执行
+    SCHEDULER_TASK("ir", Task_IR, 5000),              // 200Hz 红外采样
+    SCHEDULER_TASK("ultra", Task_Ultrasound, 20000),  // 50Hz  取新测距结果并滤波
+    SCHEDULER_TASK("control", Task_Control, 10000),   // 100Hz 避障决策
+    SCHEDULER_TASK("display", Task_Display, 100000),  // 10Hz  OLED显示
+    SCHEDULER_TASK("tlm", Task_Telemetry, 10000),     // 100Hz 串口遥测
+    SCHEDULER_TASK("cmd", Command_Poll, 10000),       // 100Hz 串口调参命令 (满速输入时不溢出接收缓冲区)
+    SCHEDULER_TASK("prof", Profile_SendNext, 100000), // 10Hz  轮流上报耗时统计
+    SCHEDULER_TASK("hist", Latency_SendNext, 500000), // 2Hz   轮流上报时间直方图
+};
+#define TASK_NUM (sizeof(Tasks) / sizeof(Tasks[0]))
 
 int main(void)
 {
@@ -27,188 +64,204 @@ int main(void)
     // 启动延时，防止上电瞬间乱跑
     Delay_ms(1000);
 
+    // 2. 启动调度器，各任务按周期运行
+    motor_last = millis();
+    Scheduler_Init(Tasks, TASK_NUM, micros);
     while (1)
     {
-        // 2. 读取所有传感器
-        r1 = IRSensor_Detect(IR_PORT, RED1_PIN); // 左前
-        r2 = IRSensor_Detect(IR_PORT, RED2_PIN); // 右前
-        r5 = IRSensor_Detect(IR_PORT, RED5_PIN); // 左侧
-        r6 = IRSensor_Detect(IR_PORT, RED6_PIN); // 右侧
-        distance = Test_Distance();
-
-        // 正常直行，超过12s，自动执行
-        if (straight_mode == 1 && straight_time >= STRAIGHT_TIMEOUT)
-        {
-            // 执行动作：倒车10cm -> 右转90度 -> 正常直行
-            Motor_MoveBack(10.0f);
-            Motor_TurnRight90();
-            Motor_ResumeNormal(); // 恢复直行速度
+        Scheduler_Dispatch();
+    }
+}
 
-            // 重置状态
-            straight_time = 0; // 清零计时器
-            straight_mode = 1; // 保持直行模式标记为1，继续视为直行状态
+// 电机任务：推进正在执行的动作
+void Task_Motor(void)
+{
+    uint32_t now = millis();
+    Maneuver_Tick(now - motor_last);
+    motor_last = now;
+}
 
-            Delay_ms(10); // 稍微防抖
-            continue;     // 【关键】跳过本次循环剩余代码，重新开始读取传感器
-        }
+// 红外任务：一次读取全部红外
+void Task_IR(void)
+{
+    uint32_t t = PROFILE_BEGIN();
+    ir_mask = IRSensor_Snapshot();
+    PROFILE_END(PROF_IR, t);
+    r1 = IR_STATE(ir_mask, IR_MASK_RED1); // 左前
+    r2 = IR_STATE(ir_mask, IR_MASK_RED2); // 右前
+    r5 = IR_STATE(ir_mask, IR_MASK_RED5); // 左侧
+    r6 = IR_STATE(ir_mask, IR_MASK_RED6); // 右侧
+    front_ir = (r1 == IR_HAVE_OBSTACLE || r2 == IR_HAVE_OBSTACLE);
+    Report_Obstacle();
+}
+
+// 超声波任务：测距在中断中完成，这里对每个新结果做中值+alpha-beta滤波，
+// 按碰撞时间判断是否需要停车：触发距离 = 余量 + 刹车距离，
+// 碰撞时间只覆盖到下一次判断前的测量和调度延时，刹车过程由刹车距离计入
+void Task_Ultrasound(void)
+{
+    float raw;
+    uint32_t seq = Ultrasound_Read(&raw);
+
+    if (seq == ultra_seq)
+        return;
+    Ranging_Update(raw, seq - ultra_seq);
+    ultra_seq = seq;
+
+    distance = Ranging_GetDistance();
+    front_ultra = Ranging_ShouldStop(Param.StopDistance + Brake_Distance(), Param.StopTtc);
+    Report_Obstacle();
+}
 
-        // 3. 判断是否需要停车 (超声波触发 或 任意前方红外触发)
-        uint8_t ultra_stop = 0;
-        if (distance > 0.1f && distance <= STOP_DISTANCE)
+// 前进中前方出现障碍时开始计算反应时间，到Motor_Stop()为止
+// (红外中断已经停车时两轮不再前进，不会重复计时)
+void Report_Obstacle(void)
+{
+    if (Motor_IsForward())
+    {
+        Latency_Obstacle(front_ir || front_ultra);
+    }
+}
+
+// 避障决策任务
+void Task_Control(void)
+{
+    uint32_t now = millis();
+
+    Latency_LoopTick();
+
+    // 判断是否需要停车 (超声波碰撞时间触发 或 消抖后的前方红外触发)
+    uint8_t ultra_stop = front_ultra;
+    uint8_t front_obstacle = (r1 == IR_HAVE_OBSTACLE || r2 == IR_HAVE_OBSTACLE);
+
+    // 红外中断锁存的前方边沿：中断中已经快速停车，但单个边沿可能是毛刺，
+    // 保持停车等消抖后的r1/r2确认，确认后才按障碍选择动作；超时未确认则照常恢复行驶
+    if (IRSensor_TakeFrontEvent() && !front_pending)
+    {
+        front_pending = 1;
+        front_pending_at = now;
+    }
+    if (front_pending)
+    {
+        if (!front_obstacle && !ultra_stop && now - front_pending_at < FRONT_CONFIRM_MS)
         {
-            ultra_stop = 1;
+            // 前进中的动作已被中断停住，中止后等待确认
+            if (Maneuver_IsBusy() && Maneuver_CurrentOp() == MV_FORWARD)
+                Maneuver_Abort();
+            return;
         }
-        uint8_t front_obstacle = (r1 == IR_HAVE_OBSTACLE || r2 == IR_HAVE_OBSTACLE);
+        front_pending = 0;
+    }
 
-        // 4. 执行场景逻辑
-        if (ultra_stop || front_obstacle)
+    // 动作执行中：前进途中出现新障碍则中止并重新决策，否则等待动作完成
+    if (Maneuver_IsBusy())
+    {
+        if (Maneuver_CurrentOp() == MV_FORWARD && (ultra_stop || front_obstacle))
         {
-            // 前方有障碍或超声波触发，退出直行模式
-            straight_mode = 0;
-            straight_time = 0;
-
-            // 场景1-5: 超声停车触发或前方红外触发
-            Motor_Stop();
-            Delay_ms(1000); // 停车1s
-
-            // 场景1: RED1+RED2同触 + RED5/6均未触
-            if (r1 == IR_HAVE_OBSTACLE && r2 == IR_HAVE_OBSTACLE &&
-                r5 == IR_NO_OBSTACLE && r6 == IR_NO_OBSTACLE)
-            {
-                Delay_ms(200);
-                Motor_MoveBack(10.0f);
-                Motor_TurnLeft90();
-                Motor_MoveForward(5.0f, NORMAL_LEFT_SPEED, NORMAL_RIGHT_SPEED);
-                Motor_TurnLeft90();
-                Motor_ResumeNormal();
-            }
-            // 场景2: RED1+RED2同触 + RED5未触+RED6触发
-            else if (r1 == IR_HAVE_OBSTACLE && r2 == IR_HAVE_OBSTACLE &&
-                     r5 == IR_NO_OBSTACLE && r6 == IR_HAVE_OBSTACLE)
-            {
-                Delay_ms(200);
-                Motor_MoveBack(10.0f);
-                Motor_TurnLeft90();
-                Motor_MoveForward(5.0f, NORMAL_LEFT_SPEED, NORMAL_RIGHT_SPEED);
-                Motor_TurnLeft90();
-                Motor_ResumeNormal();
-            }
-            // 场景3: RED1+RED2同触 + RED6未触+RED5触发
-            else if (r1 == IR_HAVE_OBSTACLE && r2 == IR_HAVE_OBSTACLE &&
-                     r5 == IR_HAVE_OBSTACLE && r6 == IR_NO_OBSTACLE)
-            {
-                Delay_ms(200);
-                Motor_MoveBack(10.0f);
-                Motor_TurnRight90();
-                Motor_MoveForward(5.0f, NORMAL_LEFT_SPEED, NORMAL_RIGHT_SPEED);
-                Motor_TurnRight90();
-                Motor_ResumeNormal();
-            }
-            // 场景4: RED1单触 + RED2/5/6均未触
-            else if (r1 == IR_HAVE_OBSTACLE && r2 == IR_NO_OBSTACLE &&
-                     r5 == IR_NO_OBSTACLE && r6 == IR_NO_OBSTACLE)
-            {
-                Motor_MoveBack(10.0f);
-                Motor_TurnRight90();
-                Motor_MoveForward(5.0f, NORMAL_LEFT_SPEED, NORMAL_RIGHT_SPEED);
-                Motor_TurnLeft90();
-                Motor_MoveForward(5.0f, NORMAL_LEFT_SPEED, NORMAL_RIGHT_SPEED);
-                Motor_TurnLeft90();
-                Motor_MoveForward(5.0f, NORMAL_LEFT_SPEED, NORMAL_RIGHT_SPEED);
-                Motor_TurnRight90();
-                Motor_ResumeNormal();
-            }
-            // 场景5: RED2单触 + RED1/5/6均未触
-            else if (r1 == IR_NO_OBSTACLE && r2 == IR_HAVE_OBSTACLE &&
-                     r5 == IR_NO_OBSTACLE && r6 == IR_NO_OBSTACLE)
-            {
-                Motor_MoveBack(10.0f);
-                Motor_TurnLeft90();
-                Motor_MoveForward(5.0f, NORMAL_LEFT_SPEED, NORMAL_RIGHT_SPEED);
-                Motor_TurnRight90();
-                Motor_MoveForward(5.0f, NORMAL_LEFT_SPEED, NORMAL_RIGHT_SPEED);
-                Motor_TurnRight90();
-                Motor_MoveForward(5.0f, NORMAL_LEFT_SPEED, NORMAL_RIGHT_SPEED);
-                Motor_TurnLeft90();
-                Motor_ResumeNormal();
-            }
-            // 兜底逻辑: 不符合以上任何情况时
-            else
-            {
-                Delay_ms(200);
-                Motor_MoveBack(10.0f);
-                Motor_TurnLeft90();
-                Motor_MoveForward(5.0f, NORMAL_LEFT_SPEED, NORMAL_RIGHT_SPEED);
-                Motor_TurnLeft90();
-                Motor_ResumeNormal();
-            }
+            Maneuver_Abort();
         }
         else
         {
-            // 前方无障碍，进入或保持在直行模式
-            if (straight_mode == 0)
-            {
-                // 新开始直行，重置计时器
-                straight_mode = 1;
-                straight_time = 0;
-            }
-
-            // 场景6: RED1/RED2均未触，根据左右传感器调整
-            // (1) 若RED5单触: 左轮加速、右轮正常（远离左墙）
-            if (r5 == IR_HAVE_OBSTACLE && r6 == IR_NO_OBSTACLE)
-            {
-                float left_speed = NORMAL_LEFT_SPEED + WALL_ADJUST_PWM;
-                if (left_speed > 99)
-                    left_speed = 99;
-                Motor_Forward(left_speed, NORMAL_RIGHT_SPEED);
-                // 巡墙也累积时间
-                straight_time += 10;
-            }
-            // (2) 若RED6单触: 右轮加速、左轮正常（远离右墙）
-            else if (r5 == IR_NO_OBSTACLE && r6 == IR_HAVE_OBSTACLE)
-            {
-                float right_speed = NORMAL_RIGHT_SPEED + WALL_ADJUST_PWM;
-                if (right_speed > 99)
-                    right_speed = 99;
-                Motor_Forward(NORMAL_LEFT_SPEED, right_speed);
-                // 巡墙也累积时间
-                straight_time += 10;
-            }
-            // 场景7: 无任何触发条件，正常直行
-            else
-            {
-                Motor_ResumeNormal();
-                straight_time += 10;
-            }
-
-            // 检查直行超时
-            // Check_Straight_Timeout();
+            return;
+        }
+    }
+
+    // 正常直行，超过12s，自动执行
+    if (straight_mode == 1 && now - straight_start >= STRAIGHT_TIMEOUT)
+    {
+        // 执行动作：倒车10cm -> 右转90度 -> 正常直行
+        Maneuver_Start(Avoid_Timeout);
+
+        // 重置状态
+        straight_start = now; // 重新计时
+        straight_mode = 1;    // 保持直行模式标记为1，继续视为直行状态
+        return;
+    }
+
+    // 执行场景逻辑
+    if (ultra_stop || front_obstacle)
+    {
+        // 前方有障碍或超声波触发，退出直行模式
+        straight_mode = 0;
+
+        // 场景1-5及兜底: 停车1s后，按红外状态查表执行对应动作
+        Maneuver_Start(Avoid_Select(ir_mask));
+    }
+    else
+    {
+        // 前方无障碍，进入或保持在直行模式
+        if (straight_mode == 0)
+        {
+            // 新开始直行，重置计时器
+            straight_mode = 1;
+            straight_start = now;
         }
 
-        Delay_ms(10); // 循环小延时
+        // 场景6: RED1/RED2均未触，根据左右传感器调整
+        // (1) 若RED5单触: 左轮加速、右轮正常（远离左墙）
+        if (r5 == IR_HAVE_OBSTACLE && r6 == IR_NO_OBSTACLE)
+        {
+            float left_speed = Param.NormalLeft + Param.WallAdjust;
+            if (left_speed > 99)
+                left_speed = 99;
+            Motor_Forward(left_speed, Param.NormalRight);
+        }
+        // (2) 若RED6单触: 右轮加速、左轮正常（远离右墙）
+        else if (r5 == IR_NO_OBSTACLE && r6 == IR_HAVE_OBSTACLE)
+        {
+            float right_speed = Param.NormalRight + Param.WallAdjust;
+            if (right_speed > 99)
+                right_speed = 99;
+            Motor_Forward(Param.NormalLeft, right_speed);
+        }
+        // 场景7: 无任何触发条件，正常直行
+        else
+        {
+            Motor_ResumeNormal();
+        }
     }
 }
 
-// 检查直行超时函数
-void Check_Straight_Timeout(void)
+// 显示任务：第1行显示距离，第2行显示红外掩码，内容先画到显存再统一刷新
+void Task_Display(void)
 {
-    if (straight_mode == 1 && straight_time >= STRAIGHT_TIMEOUT)
-    {
-        // 执行倒车10cm→右转90度→正常直行
-        Motor_MoveBack(10.0f);
-        Motor_TurnRight90();
-        Motor_ResumeNormal();
+    uint32_t t = PROFILE_BEGIN();
+    OLED_ShowNum(1, 6, distance > 0 ? (uint32_t)distance : 0, 3);
+    OLED_ShowBinNum(2, 6, ir_mask, 6);
+    OLED_Update(); // 只发送内容有变化的页
+    PROFILE_END(PROF_DISPLAY, t);
+}
 
-        // 重置计时器，保持直行模式
-        straight_time = 0;
+// 遥测任务：编码器和PID每10ms一帧，传感器每50ms一帧
+void Task_Telemetry(void)
+{
+    static uint8_t div = 0;
+    uint32_t t = PROFILE_BEGIN();
+
+    Telemetry_SendEncoder();
+    Telemetry_SendPid();
+    if (++div >= 5)
+    {
+        div = 0;
+        Telemetry_SendSensor(ir_mask, distance, Maneuver_CurrentOp());
     }
+    PROFILE_END(PROF_TLM, t);
 }
 
 void System_Init_All(void)
 {
     SystemInit();
+    NVIC_PriorityGroupConfig(NVIC_PriorityGroup_2); // 中断分组：2位抢占优先级，2位响应优先级
     delay_init();      // 延时初始化
+    Profile_Init();    // DWT周期计数器
+    Param_Load();      // 读取Flash中保存的参数 (无效时使用默认值)
     Motor_Init();      // 电机初始化 (包含TIM2和GPIO)
     IRSensor_Init();   // 红外初始化 (包含GPIO)
-    Ultrasound_Init(); // 超声波初始化 (包含TIM1和GPIO)
+    Serial_Init();     // 串口初始化 (USART1+DMA1通道4，占用PA9/RED4)
+    Telemetry_Init();  // 遥测初始化 (CRC单元)
+    Ultrasound_Init(); // 超声波初始化 (包含TIM1、EXTI1和GPIO)
+    Encoder_Init();    // 编码器初始化 (TIM3/TIM4和GPIO)
+    OLED_Init();       // OLED初始化 (PB8/PB9)
+    OLED_ShowString(1, 1, "Dist:");
+    OLED_ShowString(2, 1, "IR  :");
 }
\ No newline at end of file
@@ -4,22 +4,79 @@
 #include "stm32f10x_gpio.h"
 #include "stm32f10x_rcc.h"
 #include "delay.h"
+#include "Encoder.h"
+#include "PID.h"
+#include "Param.h"
+#include "Profile.h"
+#include "Latency.h"
+#include "Brake.h"
 
 /* 
  * DRV8833双PWM模式控制逻辑：
  * 右电机 (IN1/IN2, PA0/PA1):
  *   - 前进: IN1 = PWM, IN2 = 0
  *   - 后退: IN1 = 0, IN2 = PWM
- *   - 停止: IN1 = 0, IN2 = 0
+ *   - 停止: IN1 = 0, IN2 = 0 (惰行) 或 IN1 = IN2 = 1 (刹车)
  * 
  * 左电机 (IN3/IN4, PA2/PA3):
  *   - 前进: IN3 = 0, IN4 = PWM
  *   - 后退: IN3 = PWM, IN4 = 0
- *   - 停止: IN3 = 0, IN4 = 0
+ *   - 停止: IN3 = 0, IN4 = 0 (惰行) 或 IN3 = IN4 = 1 (刹车)
  * 
  * 注意：PA0=IN1, PA1=IN2, PA2=IN3, PA3=IN4
+ *
+ * 速度闭环：
+ * Motor_Forward/Back等函数只设定两轮的目标速度 (最大速度的百分比，后退为负)，
+ * 由SysTick中断每1ms调用Motor_ControlTick()采样编码器，每10ms用最近10ms的
+ * 计数作为实际速度计算一次PID，结果写入TIM2比较寄存器。
+ * PID输出带符号，减速时可反向驱动，输出符号决定IN1/IN2 (IN3/IN4) 哪一路出PWM。
+ * MOTOR_PID_FIXED为1时中断内使用Q16.16定点PID，不调用软件浮点库。
+ *
+ * 停车：按BRAKE_MODE惰行、短路刹车或反向脉冲后刹车 (见Brake.h)。
+ * 刹车时两路比较值写ARR+1，PWM模式1下输出一直为高。
  */
 
+// 特殊的输出值：两路全高 (正常占空比限制在±99)
+#define MOTOR_DUTY_BRAKE 100
+#define MOTOR_PWM_FULL 100 // TIM2 ARR+1
+
+#if MOTOR_PID_FIXED
+typedef q16_t motor_val_t;
+typedef PIDQ_TypeDef Motor_Pid;
+#define MOTOR_VAL(x) Q16(x)
+#define MOTOR_VAL_TO_FLOAT(x) Q16_TO_FLOAT(x)
+#define MOTOR_VAL_TO_CENTI(x) ((int16_t)(((int64_t)(x) * 100) >> 16))
+#define MOTOR_PID_CONFIG PIDQ_Config
+#define MOTOR_PID_RESET PIDQ_Reset
+#define MOTOR_PID_CALC(pid, r, y) (PIDQ_Calc(pid, r, y) >> 16)
+#else
+typedef float motor_val_t;
+typedef PID_TypeDef Motor_Pid;
+#define MOTOR_VAL(x) (x)
+#define MOTOR_VAL_TO_FLOAT(x) (x)
+#define MOTOR_VAL_TO_CENTI(x) ((int16_t)((x) * 100.0f))
+#define MOTOR_PID_CONFIG PID_Config
+#define MOTOR_PID_RESET PID_Reset
+#define MOTOR_PID_CALC(pid, r, y) ((int32_t)PID_Calc(pid, r, y))
+#endif
+
+// 单个车轮的控制状态
+typedef struct
+{
+    volatile int8_t Dir;      // 方向：1前进，-1后退，0停止
+    volatile motor_val_t Target; // 目标速度 (最大速度的百分比，后退为负)
+    int8_t LastDir;           // 上次控制周期的方向，方向变化时清PID
+    int32_t Hist[MOTOR_SPEED_WINDOW]; // 最近MOTOR_SPEED_WINDOW ms的累计计数
+    motor_val_t Speed;        // 实测速度 (最大速度的百分比，前进为正)
+    volatile uint8_t OpenLoop; // 1: 开环，直接输出Duty (自整定用)
+    volatile int16_t Duty;    // 开环占空比
+    volatile uint8_t BrakeTicks; // 反向脉冲剩余的控制周期数
+    Motor_Pid Pid;
+} Motor_Wheel;
+
+static Motor_Wheel wheel_left;
+static Motor_Wheel wheel_right;
+
 // 限制PWM范围在 0-99
 static float limit_pwm(float pwm)
 {
@@ -28,31 +85,54 @@ static float limit_pwm(float pwm)
     return pwm;
 }
 
-// 延时辅助函数（修正计算）
-static void move_delay(float cm, float speed_cm_per_sec)
+static int32_t move_target = 0;   // 本次移动的目标计数
+static int32_t move_left0 = 0;    // 移动开始时左轮计数
+static int32_t move_right0 = 0;   // 移动开始时右轮计数
+static uint32_t move_start = 0;   // 移动开始时刻(ms)
+
+// 开始按距离移动（不阻塞），cm>0前进，cm<0后退
+void Motor_MoveStart(float cm, float left_speed, float right_speed)
 {
-    if (speed_cm_per_sec <= 0) return;
-    
-    // 时间(ms) = 距离(cm) * 1000 / 速度(cm/s)
-    float time_ms = (cm * 1000.0f) / speed_cm_per_sec;
-    
-    // 假设速度70对应约15cm/s（需要实际校准）
-    float calibrated_speed = speed_cm_per_sec * 0.2f; // 调整系数
-    
-    // 限制最小延迟
-    if (time_ms < 10) time_ms = 10;
-    if (time_ms > 10000) time_ms = 10000;
-    
-    Delay_ms((uint16_t)time_ms);
+    move_left0 = Encoder_GetLeft();
+    move_right0 = Encoder_GetRight();
+    move_start = millis();
+
+    if (cm >= 0)
+    {
+        move_target = Encoder_CmToCounts(cm);
+        Motor_Forward(left_speed, right_speed);
+    }
+    else
+    {
+        move_target = Encoder_CmToCounts(-cm);
+        Motor_Back(left_speed, right_speed);
+    }
 }
 
-// 速度转PWM（DRV8833需要）
-static uint16_t speed_to_pwm(float speed_percent)
+// 检查移动是否完成：两轮平均行程达到目标，或超时（堵转/编码器故障保护）
+uint8_t Motor_MoveDone(void)
 {
-    float pwm = speed_percent;
-    if (pwm > 99) pwm = 99;
-    if (pwm < 0) pwm = 0;
-    return (uint16_t)pwm;
+    int32_t left, right, travel;
+
+    left = Encoder_GetLeft() - move_left0;
+    right = Encoder_GetRight() - move_right0;
+    if (left < 0) left = -left;
+    if (right < 0) right = -right;
+    travel = (left + right) / 2;
+
+    if (travel >= move_target) return 1;
+    if (millis() - move_start >= MOVE_TIMEOUT) return 1;
+    return 0;
+}
+
+// 车轮速度环PID：位置式，输出±100 (负值为反转)
+static void motor_pid_init(Motor_Pid *pid)
+{
+    MOTOR_PID_CONFIG(pid, PID_POSITIONAL, MOTOR_VAL(Param.MotorKp), MOTOR_VAL(Param.MotorKi),
+                     MOTOR_VAL(Param.MotorKd), MOTOR_VAL(-100.0f), MOTOR_VAL(100.0f));
+    pid->Kf = MOTOR_VAL(MOTOR_KF);
+    pid->Kaw = MOTOR_VAL(MOTOR_KAW);
+    pid->DFilter = MOTOR_VAL(MOTOR_D_FILTER);
 }
 
 void Motor_Init(void)
@@ -98,140 +178,367 @@ void Motor_Init(void)
 
     // 使能TIM2
     TIM_Cmd(TIM2, ENABLE);
+
+    motor_pid_init(&wheel_left.Pid);
+    motor_pid_init(&wheel_right.Pid);
     
     // 初始状态：停止所有电机
     Motor_Stop();
 }
 
-// 停止所有电机
+// 设定车轮方向和目标速度，实际输出由Motor_ControlTick()完成
+static void motor_set(Motor_Wheel *wheel, int8_t dir, float speed)
+{
+    wheel->Target = MOTOR_VAL(dir * limit_pwm(speed));
+    wheel->Dir = dir;
+    wheel->OpenLoop = 0;
+}
+
+/*
+ * 同时设定两轮 (关中断)：红外EXTI中断可能随时调用Motor_Stop()，
+ * 若在两轮之间或motor_set中途被打断，会出现一轮停车、另一轮继续前进的状态。
+ */
+static void motor_set_both(int8_t left_dir, float left_speed, int8_t right_dir, float right_speed)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    motor_set(&wheel_left, left_dir, left_speed);
+    motor_set(&wheel_right, right_dir, right_speed);
+    __set_PRIMASK(primask);
+}
+
+// 开环输出占空比 (%，负值反转)，绕过速度环，直到下一次调用Motor_Forward/Stop等
+void Motor_SetDuty(float left_duty, float right_duty)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    wheel_left.Dir = 0;
+    wheel_right.Dir = 0;
+    wheel_left.Duty = (int16_t)(left_duty < 0 ? -limit_pwm(-left_duty) : limit_pwm(left_duty));
+    wheel_right.Duty = (int16_t)(right_duty < 0 ? -limit_pwm(-right_duty) : limit_pwm(right_duty));
+    wheel_left.OpenLoop = 1;
+    wheel_right.OpenLoop = 1;
+    __set_PRIMASK(primask);
+}
+
+// 设置两轮速度环PID参数
+void Motor_SetGains(float kp, float ki, float kd)
+{
+    wheel_left.Pid.Kp = MOTOR_VAL(kp);
+    wheel_left.Pid.Ki = MOTOR_VAL(ki);
+    wheel_left.Pid.Kd = MOTOR_VAL(kd);
+    wheel_right.Pid.Kp = MOTOR_VAL(kp);
+    wheel_right.Pid.Ki = MOTOR_VAL(ki);
+    wheel_right.Pid.Kd = MOTOR_VAL(kd);
+}
+
+// 右电机输出：duty>0前进 IN1=PWM，duty<0后退 IN2=PWM，MOTOR_DUTY_BRAKE两路全高
+static void motor_out_right(int16_t duty)
+{
+    if (duty == MOTOR_DUTY_BRAKE)
+    {
+        TIM_SetCompare1(TIM2, MOTOR_PWM_FULL);
+        TIM_SetCompare2(TIM2, MOTOR_PWM_FULL);
+        return;
+    }
+    TIM_SetCompare1(TIM2, duty > 0 ? duty : 0);   // PA0 (IN1)
+    TIM_SetCompare2(TIM2, duty < 0 ? -duty : 0);  // PA1 (IN2)
+}
+
+// 左电机输出：duty>0前进 IN4=PWM，duty<0后退 IN3=PWM，MOTOR_DUTY_BRAKE两路全高
+static void motor_out_left(int16_t duty)
+{
+    if (duty == MOTOR_DUTY_BRAKE)
+    {
+        TIM_SetCompare3(TIM2, MOTOR_PWM_FULL);
+        TIM_SetCompare4(TIM2, MOTOR_PWM_FULL);
+        return;
+    }
+    TIM_SetCompare3(TIM2, duty < 0 ? -duty : 0);  // PA2 (IN3)
+    TIM_SetCompare4(TIM2, duty > 0 ? duty : 0);   // PA3 (IN4)
+}
+
+// 停止时的输出：反向脉冲阶段输出反向占空比，之后按BRAKE_MODE惰行或刹车
+static int16_t motor_brake_duty(Motor_Wheel *wheel)
+{
+#if BRAKE_MODE == BRAKE_REVERSE
+    if (wheel->BrakeTicks)
+    {
+        if (wheel->Speed > MOTOR_VAL(BRAKE_REVERSE_MIN))
+        {
+            wheel->BrakeTicks--;
+            return -BRAKE_REVERSE_DUTY;
+        }
+        if (wheel->Speed < MOTOR_VAL(-BRAKE_REVERSE_MIN))
+        {
+            wheel->BrakeTicks--;
+            return BRAKE_REVERSE_DUTY;
+        }
+        wheel->BrakeTicks = 0;
+    }
+#else
+    (void)wheel; // 只有反接制动用到车轮状态
+#endif
+#if BRAKE_MODE == BRAKE_COAST
+    return 0;
+#else
+    return MOTOR_DUTY_BRAKE;
+#endif
+}
+
+// 单个车轮停车，返回立即输出的占空比
+static int16_t motor_stop_wheel(Motor_Wheel *wheel)
+{
+    motor_set(wheel, 0, 0);
+    // 立即输出的这一次到下一个控制周期不足一个周期，多计一次，反向脉冲不少于BRAKE_REVERSE_MS
+    wheel->BrakeTicks = BRAKE_REVERSE_MS / MOTOR_PID_DIV + 1;
+    return motor_brake_duty(wheel);
+}
+
+// 停止所有电机（立即输出，不等待控制周期），与motor_set_both相同在关中断下同时写两轮
 void Motor_Stop(void)
 {
-    TIM_SetCompare1(TIM2, 0);  // IN1 = 0
-    TIM_SetCompare2(TIM2, 0);  // IN2 = 0
-    TIM_SetCompare3(TIM2, 0);  // IN3 = 0
-    TIM_SetCompare4(TIM2, 0);  // IN4 = 0
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    motor_out_right(motor_stop_wheel(&wheel_right));
+    motor_out_left(motor_stop_wheel(&wheel_left));
+    Latency_Stop();
+    __set_PRIMASK(primask);
 }
 
-// 前进（双PWM模式）
-void Motor_Forward(float left_pwm, float right_pwm)
+// 两轮是否都在闭环前进 (直行或贴墙修正)，可在中断中调用
+uint8_t Motor_IsForward(void)
 {
-    left_pwm = limit_pwm(left_pwm);
-    right_pwm = limit_pwm(right_pwm);
-    
-    // 右电机前进：IN1=PWM, IN2=0
-    TIM_SetCompare1(TIM2, (uint16_t)right_pwm);  // PA0 (IN1)
-    TIM_SetCompare2(TIM2, 0);                     // PA1 (IN2)
-    
-    // 左电机前进：IN3=0, IN4=PWM
-    TIM_SetCompare3(TIM2, 0);                     // PA2 (IN3)
-    TIM_SetCompare4(TIM2, (uint16_t)left_pwm);   // PA3 (IN4)
+    return wheel_left.Dir > 0 && wheel_right.Dir > 0 &&
+           !wheel_left.OpenLoop && !wheel_right.OpenLoop;
 }
 
-// 后退（双PWM模式）
-void Motor_Back(float left_pwm, float right_pwm)
+// 前进，参数为两轮目标速度 (最大速度的百分比)
+void Motor_Forward(float left_speed, float right_speed)
 {
-    left_pwm = limit_pwm(left_pwm);
-    right_pwm = limit_pwm(right_pwm);
-    
-    // 右电机后退：IN1=0, IN2=PWM
-    TIM_SetCompare1(TIM2, 0);                     // PA0 (IN1)
-    TIM_SetCompare2(TIM2, (uint16_t)right_pwm);  // PA1 (IN2)
-    
-    // 左电机后退：IN3=PWM, IN4=0
-    TIM_SetCompare3(TIM2, (uint16_t)left_pwm);   // PA2 (IN3)
-    TIM_SetCompare4(TIM2, 0);                     // PA3 (IN4)
+    motor_set_both(1, left_speed, 1, right_speed);
+}
+
+// 后退，参数为两轮目标速度 (最大速度的百分比)
+void Motor_Back(float left_speed, float right_speed)
+{
+    motor_set_both(-1, left_speed, -1, right_speed);
 }
 
-// 原地左转（左轮后退，右轮前进）
+// 原地旋转，dir>0左转（左轮后退，右轮前进），dir<0右转
+static void motor_spin(int8_t dir, float speed)
+{
+    motor_set_both(-dir, speed, dir, speed);
+}
+
+static int8_t turn_dir = 0;       // 1左转，-1右转
+static int32_t turn_target = 0;   // 目标两轮差分计数
+static int32_t turn_slow = 0;     // 开始减速的剩余差分计数
+static int32_t turn_lead = 0;     // 停车后两轮滑行的差分计数，提前这么多结束
+static int32_t turn_left0 = 0;    // 转向开始时左轮计数
+static int32_t turn_right0 = 0;   // 转向开始时右轮计数
+static uint32_t turn_start = 0;   // 转向开始时刻(ms)
+
+// 车轮以speed(%)开始刹车到停下滑过的距离(cm)
+static float motor_coast_cm(float speed)
+{
+    float v = speed / 100.0f * MOTOR_MAX_COUNTS * (1000.0f / MOTOR_SPEED_WINDOW) / ENCODER_COUNTS_PER_CM;
+
+    return v * v / (2.0f * TURN_COAST_DECEL);
+}
+
+/*
+ * 开始原地转向（不阻塞），deg>0左转，deg<0右转
+ * 航向变化(rad) = (右轮行程 - 左轮行程) / 轮距，
+ * 因此目标差分计数 = 轮距 * 角度(rad) * 每cm计数。
+ * 起步按TURN_ACCEL升速，避免轮子打滑使车体实际少转；
+ * 末段降到TURN_MIN_SPEED，按这个速度下的刹车滑行距离提前结束。
+ */
+void Motor_TurnStart(float deg)
+{
+    turn_dir = deg >= 0 ? 1 : -1;
+    if (deg < 0) deg = -deg;
+
+    turn_left0 = Encoder_GetLeft();
+    turn_right0 = Encoder_GetRight();
+    turn_start = millis();
+    turn_target = Encoder_CmToCounts(TRACK_WIDTH_CM * deg * 3.1416f / 180.0f);
+    turn_slow = Encoder_CmToCounts(TRACK_WIDTH_CM * TURN_SLOW_DEG * 3.1416f / 180.0f);
+    turn_lead = Encoder_CmToCounts(2.0f * motor_coast_cm(TURN_MIN_SPEED));
+
+    motor_spin(turn_dir, TURN_ACCEL);
+}
+
+// 检查转向是否完成，并按起步升速和接近目标时减速调整速度；超时同样视为完成
+uint8_t Motor_TurnDone(void)
+{
+    int32_t turned, remain;
+    uint32_t elapsed = millis() - turn_start;
+    float speed;
+
+    turned = (Encoder_GetRight() - turn_right0) - (Encoder_GetLeft() - turn_left0);
+    remain = turn_target - turned * turn_dir - turn_lead;
+
+    if (remain <= 0) return 1;
+    if (elapsed >= TURN_TIMEOUT) return 1;
+
+    speed = TURN_ACCEL * (elapsed + 1);
+    if (speed > TURN_SPEED)
+        speed = TURN_SPEED;
+    // 最后TURN_SLOW_DEG度内按剩余角度线性降速，减小惯性过冲
+    if (remain < turn_slow && speed > TURN_MIN_SPEED + (TURN_SPEED - TURN_MIN_SPEED) * remain / turn_slow)
+        speed = TURN_MIN_SPEED + (TURN_SPEED - TURN_MIN_SPEED) * remain / turn_slow;
+    motor_spin(turn_dir, speed);
+    return 0;
+}
+
+// 原地左转90度
 void Motor_TurnLeft90(void)
 {
-    // 左轮后退
-    TIM_SetCompare3(TIM2, (uint16_t)TURN_SPEED);  // IN3 = PWM
-    TIM_SetCompare4(TIM2, 0);                     // IN4 = 0
-    
-    // 右轮前进
-    TIM_SetCompare1(TIM2, (uint16_t)TURN_SPEED);  // IN1 = PWM
-    TIM_SetCompare2(TIM2, 0);                     // IN2 = 0
-    
-    Delay_ms(500);  // 调整时间以匹配90度转弯
+    Motor_TurnStart(90.0f);
+    while (!Motor_TurnDone());
     Motor_Stop();
 }
 
-// 原地右转（左轮前进，右轮后退）
+// 原地右转90度
 void Motor_TurnRight90(void)
 {
-    // 左轮前进
-    TIM_SetCompare3(TIM2, 0);                     // IN3 = 0
-    TIM_SetCompare4(TIM2, (uint16_t)TURN_SPEED);  // IN4 = PWM
-    
-    // 右轮后退
-    TIM_SetCompare1(TIM2, 0);                     // IN1 = 0
-    TIM_SetCompare2(TIM2, (uint16_t)TURN_SPEED);  // IN2 = PWM
-    
-    Delay_ms(500);  // 调整时间以匹配90度转弯
+    Motor_TurnStart(-90.0f);
+    while (!Motor_TurnDone());
     Motor_Stop();
 }
 
 // 右转（左轮前进，右轮停）
-void Motor_Right(float left_pwm)
+void Motor_Right(float left_speed)
 {
-    left_pwm = limit_pwm(left_pwm);
-    
-    // 左轮前进
-    TIM_SetCompare3(TIM2, 0);                    // IN3 = 0
-    TIM_SetCompare4(TIM2, (uint16_t)left_pwm);  // IN4 = PWM
-    
-    // 右轮停止
-    TIM_SetCompare1(TIM2, 0);                    // IN1 = 0
-    TIM_SetCompare2(TIM2, 0);                    // IN2 = 0
+    motor_set(&wheel_left, 1, left_speed);
+    Motor_Right_Brake();
 }
 
 // 左转（左轮停，右轮前进）
-void Motor_Left(float right_pwm)
+void Motor_Left(float right_speed)
 {
-    right_pwm = limit_pwm(right_pwm);
-    
-    // 左轮停止
-    TIM_SetCompare3(TIM2, 0);                     // IN3 = 0
-    TIM_SetCompare4(TIM2, 0);                     // IN4 = 0
-    
-    // 右轮前进
-    TIM_SetCompare1(TIM2, (uint16_t)right_pwm);  // IN1 = PWM
-    TIM_SetCompare2(TIM2, 0);                    // IN2 = 0
+    Motor_Left_Brake();
+    motor_set(&wheel_right, 1, right_speed);
 }
 
 // 向前移动指定距离
 void Motor_MoveForward(float cm, float left_speed, float right_speed)
 {
-    Motor_Forward(left_speed, right_speed);
-    move_delay(cm, (left_speed + right_speed) / 2.0f);
+    Motor_MoveStart(cm, left_speed, right_speed);
+    while (!Motor_MoveDone());
     Motor_Stop();
 }
 
 // 向后移动指定距离
 void Motor_MoveBack(float cm)
 {
-    Motor_Back(BACK_SPEED, BACK_SPEED);
-    move_delay(cm, BACK_SPEED);
+    Motor_MoveStart(-cm, BACK_SPEED, BACK_SPEED);
+    while (!Motor_MoveDone());
     Motor_Stop();
 }
 
 // 恢复正常直行
 void Motor_ResumeNormal(void)
 {
-    Motor_Forward(NORMAL_LEFT_SPEED, NORMAL_RIGHT_SPEED);
+    Motor_Forward(Param.NormalLeft, Param.NormalRight);
 }
 
 // 左电机刹车
 void Motor_Left_Brake(void)
 {
-    TIM_SetCompare3(TIM2, 0);
-    TIM_SetCompare4(TIM2, 0);
+    motor_out_left(motor_stop_wheel(&wheel_left));
 }
 
 // 右电机刹车
 void Motor_Right_Brake(void)
 {
-    TIM_SetCompare1(TIM2, 0);
-    TIM_SetCompare2(TIM2, 0);
-}
\ No newline at end of file
+    motor_out_right(motor_stop_wheel(&wheel_right));
+}
+
+// 单个车轮的速度采样和PID计算，返回带符号的输出占空比
+static int16_t motor_wheel_update(Motor_Wheel *wheel, int32_t count, uint8_t idx, uint8_t calc)
+{
+    int8_t dir = wheel->Dir;
+    int32_t duty;
+    uint32_t t;
+    int32_t delta = count - wheel->Hist[idx]; // 最近MOTOR_SPEED_WINDOW ms的计数
+    wheel->Hist[idx] = count;
+
+    if (!calc) return 0;
+
+#if MOTOR_PID_FIXED
+    wheel->Speed = delta * (100 * Q16_ONE / MOTOR_MAX_COUNTS);
+#else
+    wheel->Speed = (float)delta * 100.0f / MOTOR_MAX_COUNTS;
+#endif
+    if (dir != wheel->LastDir)
+    {
+        // 启动或换向：清除积分和微分历史，避免沿用上一段的输出
+        MOTOR_PID_RESET(&wheel->Pid);
+        wheel->LastDir = dir;
+    }
+    if (wheel->OpenLoop) return wheel->Duty;
+    if (dir == 0) return motor_brake_duty(wheel);
+
+    t = PROFILE_BEGIN();
+    duty = MOTOR_PID_CALC(&wheel->Pid, wheel->Target, wheel->Speed);
+    PROFILE_END(PROF_PID, t);
+    if (duty > 99) duty = 99;
+    if (duty < -99) duty = -99;
+    return (int16_t)duty;
+}
+
+/*
+ * 速度控制周期函数，由SysTick_Handler每1ms调用
+ * 每次都采样编码器以更新速度窗口，每MOTOR_PID_DIV次计算一次PID并更新PWM
+ */
+void Motor_ControlTick(void)
+{
+    static uint8_t idx = 0;
+    static uint8_t div = 0;
+    uint8_t calc;
+    int16_t left_duty, right_duty;
+
+    Encoder_Update();
+
+    calc = (++div >= MOTOR_PID_DIV);
+    if (calc) div = 0;
+
+    left_duty = motor_wheel_update(&wheel_left, Encoder_GetLeft(), idx, calc);
+    right_duty = motor_wheel_update(&wheel_right, Encoder_GetRight(), idx, calc);
+    if (++idx >= MOTOR_SPEED_WINDOW) idx = 0;
+
+    if (calc)
+    {
+        motor_out_left(left_duty);
+        motor_out_right(right_duty);
+    }
+}
+
+// 实测车轮速度 (最大速度的百分比，前进为正)
+float Motor_GetLeftSpeed(void)
+{
+    return MOTOR_VAL_TO_FLOAT(wheel_left.Speed);
+}
+
+float Motor_GetRightSpeed(void)
+{
+    return MOTOR_VAL_TO_FLOAT(wheel_right.Speed);
+}
+
+// 速度环状态快照 (遥测用)，单位0.01：目标速度、实测速度、误差、积分项、微分项、输出
+void Motor_GetPidState(uint8_t right, int16_t state[MOTOR_PID_STATE_NUM])
+{
+    Motor_Wheel *wheel = right ? &wheel_right : &wheel_left;
+
+    state[0] = MOTOR_VAL_TO_CENTI(wheel->Target);
+    state[1] = MOTOR_VAL_TO_CENTI(wheel->Speed);
+    state[2] = MOTOR_VAL_TO_CENTI(wheel->Pid.Error);
+    state[3] = MOTOR_VAL_TO_CENTI(wheel->Pid.Integral);
+    state[4] = MOTOR_VAL_TO_CENTI(wheel->Pid.DTerm);
+    state[5] = MOTOR_VAL_TO_CENTI(wheel->Pid.Output);
+}
@@ -25,11 +25,32 @@
 #define MOTOR_TT2_B GPIO_Pin_7
 
 // ????
-#define NORMAL_LEFT_SPEED 84.0f  // ???????
-#define NORMAL_RIGHT_SPEED 79.5f // ???????(??????)
+#define NORMAL_LEFT_SPEED 80.0f  // 正常直行左轮速度默认值 (最大速度的百分比)
+#define NORMAL_RIGHT_SPEED 80.0f // 正常直行右轮速度默认值，速度闭环后两轮一致
 
 #define TURN_SPEED 90.0f // ????
 #define BACK_SPEED 90.0f // ????
+#define TURN_MIN_SPEED 40.0f // 转向末段最低速度
+#define TURN_SLOW_DEG 30.0f  // 距目标多少度开始减速
+#define TURN_ACCEL 0.5f      // 转向起步每ms升速(%)，轮子加速过猛会打滑，车体少转
+#define TURN_COAST_DECEL 400.0f // 转向结束刹车时车轮的减速度(cm/s^2)，用于计算提前结束的滑行量
+#define TURN_TIMEOUT 2000    // 转向超时保护(ms)
+#define TRACK_WIDTH_CM 13.0f // 两轮轮距(cm)，需实际标定
+
+// 速度闭环参数
+#define MOTOR_MAX_COUNTS 35    // 满速时MOTOR_SPEED_WINDOW ms内的编码器计数，需实际标定
+#define MOTOR_SPEED_WINDOW 10  // 测速窗口(ms)
+#define MOTOR_PID_DIV 10       // 每多少个控制周期(1ms)计算一次PID
+#define MOTOR_PID_FIXED 1      // 1: 定点PID (Q16.16)，0: 浮点PID
+
+// 车轮速度环PID默认参数 (输入为速度%，输出为占空比%)，Flash中有自整定结果时以其为准
+#define MOTOR_KP 1.5f
+#define MOTOR_KI 0.1f
+#define MOTOR_KD 0.05f
+#define MOTOR_KF 1.0f        // 速度前馈：目标速度%近似对应占空比%
+#define MOTOR_KAW 0.5f       // 反算抗饱和系数
+#define MOTOR_D_FILTER 0.3f  // 微分低通系数
+#define MOVE_TIMEOUT 3000 // 按距离移动的超时保护(ms)，防止堵转时一直等待
 
 // ?????????
 #define IR_PORT GPIOA
@@ -48,10 +69,11 @@
 // ????
 void Motor_Init(void);
 void Motor_Stop(void);
-void Motor_Forward(float left_pwm, float right_pwm);
-void Motor_Back(float left_pwm, float right_pwm);
-void Motor_Left(float right_pwm);
-void Motor_Right(float left_pwm);
+void Motor_Forward(float left_speed, float right_speed);
+uint8_t Motor_IsForward(void);
+void Motor_Back(float left_speed, float right_speed);
+void Motor_Left(float right_speed);
+void Motor_Right(float left_speed);
 void Motor_Left_Brake(void);
 void Motor_Right_Brake(void);
 void Motor_MoveBack(float cm);
@@ -59,5 +81,17 @@ void Motor_MoveForward(float cm, float left_speed, float right_speed);
 void Motor_TurnRight90(void);
 void Motor_TurnLeft90(void);
 void Motor_ResumeNormal(void);
+void Motor_MoveStart(float cm, float left_speed, float right_speed);
+uint8_t Motor_MoveDone(void);
+void Motor_TurnStart(float deg);
+uint8_t Motor_TurnDone(void);
+void Motor_ControlTick(void);
+void Motor_SetDuty(float left_duty, float right_duty);
+void Motor_SetGains(float kp, float ki, float kd);
+float Motor_GetLeftSpeed(void);
+float Motor_GetRightSpeed(void);
+
+#define MOTOR_PID_STATE_NUM 6
+void Motor_GetPidState(uint8_t right, int16_t state[MOTOR_PID_STATE_NUM]);
 
 #endif
\ No newline at end of file
@@ -1,10 +1,219 @@
 #include "stm32f10x.h"
 #include "OLED_Font.h"
 #include "delay.h"
+#include "oled.h"
+#include "Format.h"
+
+/*
+ * 显示内容先画到RAM中的显存 (8页 x 128列，每字节为一列8个像素)，
+ * 内容有变化的页记入OLED_Dirty，调用OLED_Update()时才发送到屏幕。
+ * 每个脏页只用一次I2C传输：设置页地址和列地址后连续写128字节数据。
+ */
+static uint8_t OLED_Buf[OLED_PAGES][OLED_WIDTH];
+static volatile uint8_t OLED_Dirty = 0; // 第n位为1表示第n页需要刷新
+
+// 页传输前缀：控制字节0x80表示后面跟1个命令字节且还有后续控制字节，0x40表示其后全是数据
+#define OLED_PAGE_PREFIX 7
+static void OLED_PagePrefix(uint8_t *Buf, uint8_t Page)
+{
+	Buf[0] = 0x80;
+	Buf[1] = 0xB0 | Page;  // 页地址
+	Buf[2] = 0x80;
+	Buf[3] = 0x10;         // 列地址高4位 = 0
+	Buf[4] = 0x80;
+	Buf[5] = 0x00;         // 列地址低4位 = 0
+	Buf[6] = 0x40;
+}
+
+#if OLED_USE_HW_I2C
+
+/*
+ * 硬件I2C后端：I2C1重映射到PB8(SCL)/PB9(SDA)，400kHz。
+ * OLED_Update()只启动传输，之后由I2C1事件中断推进：
+ *   SB   -> 发送从机地址
+ *   ADDR -> 清ADDR，DMA1通道6开始把整页数据写入DR
+ *   BTF  -> DMA已发完最后一个字节，发STOP，继续下一个脏页
+ * 所有脏页发送完后调用完成回调。发送前先把页数据拷贝到OLED_TxBuf，
+ * 传输期间可以继续往显存画图，被改动的页会在下一轮重新发送。
+ */
+#define OLED_ADDR 0x78
+#define OLED_I2C_TIMEOUT 10000
+
+static uint8_t OLED_TxBuf[OLED_PAGE_PREFIX + OLED_WIDTH];
+static volatile uint8_t OLED_Busy = 0;
+static void (*OLED_DoneCallback)(void) = 0;
+
+static void OLED_I2C_Init(void)
+{
+	GPIO_InitTypeDef GPIO_InitStructure;
+	I2C_InitTypeDef I2C_InitStructure;
+	DMA_InitTypeDef DMA_InitStructure;
+	NVIC_InitTypeDef NVIC_InitStructure;
+
+	RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOB | RCC_APB2Periph_AFIO, ENABLE);
+	RCC_APB1PeriphClockCmd(RCC_APB1Periph_I2C1, ENABLE);
+	RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+
+	GPIO_PinRemapConfig(GPIO_Remap_I2C1, ENABLE);
+	GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF_OD;
+	GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
+	GPIO_InitStructure.GPIO_Pin = GPIO_Pin_8 | GPIO_Pin_9;
+	GPIO_Init(GPIOB, &GPIO_InitStructure);
+
+	I2C_DeInit(I2C1);
+	I2C_InitStructure.I2C_Mode = I2C_Mode_I2C;
+	I2C_InitStructure.I2C_DutyCycle = I2C_DutyCycle_2;
+	I2C_InitStructure.I2C_OwnAddress1 = 0x00;
+	I2C_InitStructure.I2C_Ack = I2C_Ack_Enable;
+	I2C_InitStructure.I2C_AcknowledgedAddress = I2C_AcknowledgedAddress_7bit;
+	I2C_InitStructure.I2C_ClockSpeed = 400000;
+	I2C_Init(I2C1, &I2C_InitStructure);
+	I2C_Cmd(I2C1, ENABLE);
+
+	// DMA1通道6 (I2C1_TX)：OLED_TxBuf -> I2C1->DR
+	DMA_DeInit(DMA1_Channel6);
+	DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&I2C1->DR;
+	DMA_InitStructure.DMA_MemoryBaseAddr = (uint32_t)OLED_TxBuf;
+	DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralDST;
+	DMA_InitStructure.DMA_BufferSize = sizeof(OLED_TxBuf);
+	DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+	DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+	DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+	DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+	DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+	DMA_InitStructure.DMA_Priority = DMA_Priority_Low;
+	DMA_InitStructure.DMA_M2M = DMA_M2M_Disable;
+	DMA_Init(DMA1_Channel6, &DMA_InitStructure);
+
+	// 显示刷新优先级最低
+	NVIC_InitStructure.NVIC_IRQChannel = I2C1_EV_IRQn;
+	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 3;
+	NVIC_InitStructure.NVIC_IRQChannelSubPriority = 2;
+	NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+	NVIC_Init(&NVIC_InitStructure);
+	NVIC_InitStructure.NVIC_IRQChannel = I2C1_ER_IRQn;
+	NVIC_Init(&NVIC_InitStructure);
+}
+
+// 等待I2C事件，超时返回0
+static uint8_t OLED_I2C_WaitEvent(uint32_t Event)
+{
+	uint32_t Timeout = OLED_I2C_TIMEOUT;
+	while (I2C_CheckEvent(I2C1, Event) != SUCCESS)
+	{
+		if (--Timeout == 0) return 0;
+	}
+	return 1;
+}
+
+// 轮询方式写命令 (仅初始化时使用)
+static void OLED_WriteCommand(uint8_t Command)
+{
+	I2C_GenerateSTART(I2C1, ENABLE);
+	if (OLED_I2C_WaitEvent(I2C_EVENT_MASTER_MODE_SELECT))
+	{
+		I2C_Send7bitAddress(I2C1, OLED_ADDR, I2C_Direction_Transmitter);
+		if (OLED_I2C_WaitEvent(I2C_EVENT_MASTER_TRANSMITTER_MODE_SELECTED))
+		{
+			I2C_SendData(I2C1, 0x00);
+			if (OLED_I2C_WaitEvent(I2C_EVENT_MASTER_BYTE_TRANSMITTING))
+			{
+				I2C_SendData(I2C1, Command);
+				OLED_I2C_WaitEvent(I2C_EVENT_MASTER_BYTE_TRANSMITTED);
+			}
+		}
+	}
+	I2C_GenerateSTOP(I2C1, ENABLE);
+}
+
+// 取出下一个脏页并启动传输，没有脏页时返回0 (在中断或关中断状态下调用)
+static uint8_t OLED_StartNextPage(void)
+{
+	uint8_t i, Page;
+
+	for (Page = 0; Page < OLED_PAGES; Page++)
+	{
+		if (OLED_Dirty & (1 << Page)) break;
+	}
+	if (Page >= OLED_PAGES) return 0;
+
+	OLED_Dirty &= ~(1 << Page);
+	OLED_PagePrefix(OLED_TxBuf, Page);
+	for (i = 0; i < OLED_WIDTH; i++) OLED_TxBuf[OLED_PAGE_PREFIX + i] = OLED_Buf[Page][i];
+
+	DMA_Cmd(DMA1_Channel6, DISABLE);
+	DMA_SetCurrDataCounter(DMA1_Channel6, sizeof(OLED_TxBuf));
+	I2C_DMACmd(I2C1, ENABLE);
+	I2C_ITConfig(I2C1, I2C_IT_EVT | I2C_IT_ERR, ENABLE);
+	I2C_GenerateSTART(I2C1, ENABLE);
+	return 1;
+}
+
+// 一轮刷新结束
+static void OLED_Finish(void)
+{
+	I2C_ITConfig(I2C1, I2C_IT_EVT | I2C_IT_ERR, DISABLE);
+	I2C_DMACmd(I2C1, DISABLE);
+	DMA_Cmd(DMA1_Channel6, DISABLE);
+	OLED_Busy = 0;
+	if (OLED_DoneCallback) OLED_DoneCallback();
+}
+
+// 启动后台刷新 (不阻塞)；上一轮还在进行时直接返回，新的脏页会在本轮中一并发送
+void OLED_Update(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	if (!OLED_Busy && OLED_StartNextPage())
+		OLED_Busy = 1;
+	__set_PRIMASK(primask);
+}
+
+// 是否正在后台刷新
+uint8_t OLED_IsBusy(void)
+{
+	return OLED_Busy;
+}
+
+// 设置刷新完成回调 (在中断中调用，应尽量短)
+void OLED_SetDoneCallback(void (*Callback)(void))
+{
+	OLED_DoneCallback = Callback;
+}
+
+void I2C1_EV_IRQHandler(void)
+{
+	uint16_t SR1 = I2C1->SR1;
+
+	if (SR1 & I2C_SR1_SB)
+	{
+		I2C_Send7bitAddress(I2C1, OLED_ADDR, I2C_Direction_Transmitter);
+	}
+	else if (SR1 & I2C_SR1_ADDR)
+	{
+		DMA_Cmd(DMA1_Channel6, ENABLE);
+		(void)I2C1->SR2; // 读SR1后读SR2清除ADDR，DMA开始发送
+	}
+	else if (SR1 & I2C_SR1_BTF)
+	{
+		I2C_GenerateSTOP(I2C1, ENABLE);
+		while (I2C1->CR1 & I2C_CR1_STOP); // STOP发出后才能发下一个START (约几us)
+		if (!OLED_StartNextPage()) OLED_Finish();
+	}
+}
+
+// 总线错误或无应答 (未接屏幕)：放弃本轮刷新
+void I2C1_ER_IRQHandler(void)
+{
+	I2C_GenerateSTOP(I2C1, ENABLE);
+	I2C1->SR1 &= ~(I2C_SR1_AF | I2C_SR1_BERR | I2C_SR1_ARLO | I2C_SR1_OVR);
+	OLED_Finish();
+}
+
+#else
 
 #define OLED_W_SCL(x) GPIO_WriteBit(GPIOB, GPIO_Pin_8, (BitAction)(x))
 #define OLED_W_SDA(x) GPIO_WriteBit(GPIOB, GPIO_Pin_9, (BitAction)(x))
-
 static void OLED_I2C_Init(void)
 {
     RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOB, ENABLE);
@@ -59,48 +268,95 @@ static void OLED_WriteCommand(uint8_t Command)
 	OLED_I2C_Stop();
 }
 
-static void OLED_WriteData(uint8_t Data)
+// 发送一整页
+static void OLED_WritePage(uint8_t Page)
 {
+	uint8_t i, Prefix[OLED_PAGE_PREFIX];
+	OLED_PagePrefix(Prefix, Page);
 	OLED_I2C_Start();
 	OLED_I2C_SendByte(0x78);
-	OLED_I2C_SendByte(0x40);
-	OLED_I2C_SendByte(Data);
+	for (i = 0; i < OLED_PAGE_PREFIX; i++) OLED_I2C_SendByte(Prefix[i]);
+	for (i = 0; i < OLED_WIDTH; i++) OLED_I2C_SendByte(OLED_Buf[Page][i]);
 	OLED_I2C_Stop();
 }
 
-static void OLED_SetCursor(uint8_t Y, uint8_t X)
+// 把脏页发送到屏幕 (阻塞)
+void OLED_Update(void)
+{
+	uint8_t j;
+	for (j = 0; j < OLED_PAGES; j++)
+	{
+		if (OLED_Dirty & (1 << j))
+		{
+			OLED_WritePage(j);
+			OLED_Dirty &= ~(1 << j);
+		}
+	}
+}
+
+uint8_t OLED_IsBusy(void)
+{
+	return 0;
+}
+
+// 软件I2C为阻塞发送，OLED_Update()返回时即已完成
+void OLED_SetDoneCallback(void (*Callback)(void))
 {
-	OLED_WriteCommand(0xB0 | Y);
-	OLED_WriteCommand(0x10 | ((X & 0xF0) >> 4));
-	OLED_WriteCommand(0x00 | (X & 0x0F));
+	(void)Callback;
+}
+
+#endif
+
+// 显存地址 (只读，调试用)
+const uint8_t *OLED_GetBuffer(void)
+{
+	return &OLED_Buf[0][0];
+}
+
+// 待刷新的页 (第n位对应第n页，调试用)
+uint8_t OLED_GetDirty(void)
+{
+	return OLED_Dirty;
+}
+
+// 把一个8x16点阵写入显存，内容不变的页不标脏
+static void OLED_DrawGlyph(uint8_t Line, uint8_t Column, const uint8_t *Glyph)
+{
+	uint8_t i, j, Page, X;
+	if (Line < 1 || Line > OLED_PAGES / 2 || Column < 1 || Column > OLED_WIDTH / 8) return;
+	Page = (Line - 1) * 2;
+	X = (Column - 1) * 8;
+	for (j = 0; j < 2; j++)
+	{
+		for (i = 0; i < 8; i++)
+		{
+			if (OLED_Buf[Page + j][X + i] != Glyph[j * 8 + i])
+			{
+				OLED_Buf[Page + j][X + i] = Glyph[j * 8 + i];
+				OLED_Dirty |= 1 << (Page + j);
+			}
+		}
+	}
 }
 
 void OLED_Clear(void)
 {
 	uint8_t i, j;
-	for (j = 0; j < 8; j++)
+	for (j = 0; j < OLED_PAGES; j++)
 	{
-		OLED_SetCursor(j, 0);
-		for(i = 0; i < 128; i++) OLED_WriteData(0x00);
+		for (i = 0; i < OLED_WIDTH; i++) OLED_Buf[j][i] = 0x00;
 	}
+	OLED_Dirty = 0xFF;
 }
 
 void OLED_ShowChar(uint8_t Line, uint8_t Column, char Char)
 {
-	uint8_t i;
-	OLED_SetCursor((Line - 1) * 2, (Column - 1) * 8);
-	for (i = 0; i < 8; i++) OLED_WriteData(OLED_F8x16[Char - ' '][i]);
-	OLED_SetCursor((Line - 1) * 2 + 1, (Column - 1) * 8);
-	for (i = 0; i < 8; i++) OLED_WriteData(OLED_F8x16[Char - ' '][i + 8]);
+	OLED_DrawGlyph(Line, Column, OLED_F8x16[Char - ' ']);
 }
 
 void OLED_ShowChinese(uint8_t Line, uint8_t Column, uint8_t num)
 {
-	uint8_t i;
-	OLED_SetCursor((Line - 1) * 2, (Column - 1) * 8);
-	for (i = 0; i < 8; i++) OLED_WriteData(OLED_chinese[num][i]);
-	OLED_SetCursor((Line - 1) * 2 + 1, (Column - 1) * 8);
-	for (i = 0; i < 8; i++) OLED_WriteData(OLED_chinese[num][i + 8]);
+	OLED_DrawGlyph(Line, Column, OLED_chinese[num]);
 }
 
 void OLED_ShowChinese2(uint8_t Line, uint8_t Column, uint8_t num)
@@ -115,25 +371,23 @@ void OLED_ShowString(uint8_t Line, uint8_t Column, char *String)
 	for (i = 0; String[i] != '\0'; i++) OLED_ShowChar(Line, Column + i, String[i]);
 }
 
-static uint32_t OLED_Pow(uint32_t X, uint32_t Y)
+// 逐个显示已转换好的字符
+static void OLED_ShowDigits(uint8_t Line, uint8_t Column, const char *Digits, uint8_t Length)
 {
-	uint32_t Result = 1;
-	while (Y--) Result *= X;
-	return Result;
+	uint8_t i;
+	for (i = 0; i < Length; i++) OLED_ShowChar(Line, Column + i, Digits[i]);
 }
 
 void OLED_ShowNum(uint8_t Line, uint8_t Column, uint32_t Number, uint8_t Length)
 {
-	uint8_t i;
-	for (i = 0; i < Length; i++)
-	{
-		OLED_ShowChar(Line, Column + i, Number / OLED_Pow(10, Length - i - 1) % 10 + '0');
-	}
+	char Digits[16];
+	if (Length > sizeof(Digits)) Length = sizeof(Digits);
+	Format_Dec(Digits, Number, Length);
+	OLED_ShowDigits(Line, Column, Digits, Length);
 }
 
 void OLED_ShowSignedNum(uint8_t Line, uint8_t Column, int32_t Number, uint8_t Length)
 {
-	uint8_t i;
 	uint32_t Number1;
 	if (Number >= 0)
 	{
@@ -143,31 +397,25 @@ void OLED_ShowSignedNum(uint8_t Line, uint8_t Column, int32_t Number, uint8_t Le
 	else
 	{
 		OLED_ShowChar(Line, Column, '-');
-		Number1 = -Number;
-	}
-	for (i = 0; i < Length; i++)
-	{
-		OLED_ShowChar(Line, Column + i + 1, Number1 / OLED_Pow(10, Length - i - 1) % 10 + '0');
+		Number1 = -(uint32_t)Number;
 	}
+	OLED_ShowNum(Line, Column + 1, Number1, Length);
 }
 
 void OLED_ShowHexNum(uint8_t Line, uint8_t Column, uint32_t Number, uint8_t Length)
 {
-	uint8_t i, SingleNumber;
-	for (i = 0; i < Length; i++)
-	{
-		SingleNumber = Number / OLED_Pow(16, Length - i - 1) % 16;
-		OLED_ShowChar(Line, Column + i, SingleNumber < 10 ? SingleNumber + '0' : SingleNumber -10 + 'A');
-	}
+	char Digits[16];
+	if (Length > sizeof(Digits)) Length = sizeof(Digits);
+	Format_Hex(Digits, Number, Length);
+	OLED_ShowDigits(Line, Column, Digits, Length);
 }
 
 void OLED_ShowBinNum(uint8_t Line, uint8_t Column, uint32_t Number, uint8_t Length)
 {
-	uint8_t i;
-	for (i = 0; i < Length; i++)
-	{
-		OLED_ShowChar(Line, Column + i, Number / OLED_Pow(2, Length - i - 1) % 2 + '0');
-	}
+	char Digits[32];
+	if (Length > sizeof(Digits)) Length = sizeof(Digits);
+	Format_Bin(Digits, Number, Length);
+	OLED_ShowDigits(Line, Column, Digits, Length);
 }
 
 void OLED_Init(void)
@@ -200,4 +448,5 @@ void OLED_Init(void)
 	OLED_WriteCommand(0xAF);
 	
 	OLED_Clear();
+	OLED_Update();
 }
@@ -2,7 +2,21 @@
 #define __OLED_H
 
 #include "stdint.h"
+
+#define OLED_WIDTH 128
+#define OLED_PAGES 8
+
+// 1: 硬件I2C1 (重映射到PB8/PB9) + DMA后台刷新，0: 软件模拟I2C (阻塞)
+#ifndef OLED_USE_HW_I2C
+#define OLED_USE_HW_I2C 1
+#endif
+
 void OLED_Init(void);
+void OLED_Update(void);
+uint8_t OLED_IsBusy(void);
+void OLED_SetDoneCallback(void (*Callback)(void));
+const uint8_t *OLED_GetBuffer(void);
+uint8_t OLED_GetDirty(void);
 void OLED_Clear(void);
 void OLED_ShowChar(uint8_t Line, uint8_t Column, char Char);
 void OLED_ShowString(uint8_t Line, uint8_t Column, char *String);
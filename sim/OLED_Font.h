@@ -0,0 +1,2 @@
+// 源码中写作 OLED_Font.h，实际文件名为 oled_Font.h；区分大小写的文件系统上由此转接
+#include "../oled_Font.h"
@@ -0,0 +1,643 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "sim.h"
+#include "IRSensor.h"
+#include "Encoder.h"
+#include "motor.h"
+#include "Profile.h"
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE 0x100000
+#endif
+
+// 中断函数 (由固件提供)
+void SysTick_Handler(void);
+void TIM1_UP_IRQHandler(void);
+void TIM1_CC_IRQHandler(void);
+void EXTI1_IRQHandler(void);
+void EXTI4_IRQHandler(void);
+void EXTI9_5_IRQHandler(void);
+void DMA1_Channel4_IRQHandler(void);
+void USART1_IRQHandler(void);
+
+uint32_t SystemCoreClock = 72000000;
+
+// DWT_CYCCNT寄存器本身 (固件通过Sim_DwtCyccnt访问)
+#define DWT_CYCCNT_REG (*(volatile uint32_t *)0xE0001004)
+
+uint64_t Sim_Now = 0;
+uint64_t Sim_End = 10000000;
+FILE *Sim_PwmLog = 0;
+FILE *Sim_UartLog = 0;
+void (*Sim_PlantTick)(void) = Sim_WheelModel;
+
+// 映射为主机内存的地址区间 (需以 -no-pie 链接，固件中的32位地址才能直接使用)
+static const struct
+{
+    uint32_t Base;
+    uint32_t Size;
+    uint8_t Fill;
+} Sim_Regions[] = {
+    {0x08000000, 0x00010000, 0xFF}, // Flash (擦除状态)
+    {0x40000000, 0x00030000, 0x00}, // APB1/APB2/AHB外设
+    {0xE0000000, 0x00100000, 0x00}, // Cortex-M3内核外设
+};
+
+// ================= 中断 =================
+// 按固件配置的优先级从高到低排列；中断不嵌套，同一时刻按此顺序执行
+enum
+{
+    SIM_IRQ_EXTI1,
+    SIM_IRQ_TIM1_CC,
+    SIM_IRQ_TIM1_UP,
+    SIM_IRQ_SYSTICK,
+    SIM_IRQ_EXTI4,
+    SIM_IRQ_EXTI9_5,
+    SIM_IRQ_DMA1_CH4,
+    SIM_IRQ_USART1,
+    SIM_IRQ_NUM
+};
+
+static uint32_t Sim_Pending = 0;
+static uint32_t Sim_Primask = 0;
+static uint8_t Sim_InIsr = 0;
+
+uint32_t __get_PRIMASK(void)
+{
+    return Sim_Primask;
+}
+
+void __set_PRIMASK(uint32_t priMask)
+{
+    Sim_Primask = priMask & 1;
+}
+
+void Sim_DisableIrq(void)
+{
+    Sim_Primask = 1;
+}
+
+void Sim_EnableIrq(void)
+{
+    Sim_Primask = 0;
+}
+
+// 目标上由启动文件调用，仿真中不需要配置时钟
+void SystemInit(void)
+{
+}
+
+// 调用中断函数；写1清零/写0清零的标志在中断返回后由仿真器清除。
+// NVIC->ISER是写1置位，连续写入在内存模型中会互相覆盖，因此只看外设自身的中断使能位
+static void sim_deliver(void)
+{
+    uint8_t i;
+
+    if (Sim_InIsr || Sim_Primask)
+        return;
+
+    Sim_InIsr = 1;
+    for (i = 0; i < SIM_IRQ_NUM; i++)
+    {
+        if (!(Sim_Pending & (1u << i)))
+            continue;
+        Sim_Pending &= ~(1u << i);
+
+        switch (i)
+        {
+        case SIM_IRQ_EXTI1:
+            EXTI1_IRQHandler();
+            EXTI->PR &= ~EXTI_Line1;
+            break;
+        case SIM_IRQ_EXTI4:
+            EXTI4_IRQHandler();
+            EXTI->PR &= ~EXTI_Line4;
+            break;
+        case SIM_IRQ_EXTI9_5:
+            EXTI9_5_IRQHandler();
+            EXTI->PR &= ~0x03E0u;
+            break;
+        case SIM_IRQ_TIM1_CC:
+            TIM1_CC_IRQHandler();
+            TIM1->SR &= ~TIM_SR_CC1IF;
+            break;
+        case SIM_IRQ_TIM1_UP:
+            TIM1_UP_IRQHandler();
+            TIM1->SR &= ~TIM_SR_UIF;
+            break;
+        case SIM_IRQ_SYSTICK:
+            SysTick_Handler();
+            break;
+        case SIM_IRQ_DMA1_CH4:
+            DMA1_Channel4_IRQHandler();
+            DMA1->ISR &= ~(DMA_ISR_GIF4 | DMA_ISR_TCIF4);
+            break;
+        case SIM_IRQ_USART1:
+            USART1_IRQHandler();
+            USART1->SR &= ~(USART_SR_RXNE | USART_SR_ORE);
+            break;
+        }
+        Sim_Sync();
+    }
+    Sim_InIsr = 0;
+}
+
+// ================= GPIO =================
+static GPIO_TypeDef *const Sim_Ports[] = {GPIOA, GPIOB, GPIOC};
+#define SIM_PORT_NUM (sizeof(Sim_Ports) / sizeof(Sim_Ports[0]))
+
+static uint16_t Sim_Input[SIM_PORT_NUM]; // 外部驱动的引脚电平
+static uint16_t Sim_LastOdr[SIM_PORT_NUM];
+static uint32_t Sim_LastCr[SIM_PORT_NUM][2];
+static uint16_t Sim_OutMask[SIM_PORT_NUM];
+
+static int sim_port_index(GPIO_TypeDef *port)
+{
+    uint8_t i;
+    for (i = 0; i < SIM_PORT_NUM; i++)
+    {
+        if (Sim_Ports[i] == port)
+            return i;
+    }
+    return -1;
+}
+
+// 配置为通用输出 (MODE != 00，CNF1 = 0) 的引脚；
+// 复用功能输出 (串口TX、I2C) 空闲时为高电平，按外部输入处理
+static uint16_t gpio_output_mask(GPIO_TypeDef *port)
+{
+    uint16_t mask = 0;
+    uint8_t pin;
+    uint32_t cr;
+
+    for (pin = 0; pin < 16; pin++)
+    {
+        cr = pin < 8 ? port->CRL : port->CRH;
+        cr >>= (pin & 7) * 4;
+        if ((cr & 0x3) && !(cr & 0x8))
+            mask |= 1 << pin;
+    }
+    return mask;
+}
+
+// 执行BSRR/BRR写入，输入引脚取外部电平，输出引脚读回ODR
+static void gpio_sync(void)
+{
+    uint8_t i;
+    uint32_t bsrr;
+    uint16_t out;
+    GPIO_TypeDef *port;
+
+    for (i = 0; i < SIM_PORT_NUM; i++)
+    {
+        port = Sim_Ports[i];
+        bsrr = port->BSRR;
+        if (bsrr || port->BRR)
+        {
+            port->ODR = ((port->ODR & ~(bsrr >> 16)) | (bsrr & 0xFFFF)) & ~port->BRR & 0xFFFF;
+            port->BSRR = 0;
+            port->BRR = 0;
+        }
+        if (port->CRL != Sim_LastCr[i][0] || port->CRH != Sim_LastCr[i][1])
+        {
+            Sim_LastCr[i][0] = port->CRL;
+            Sim_LastCr[i][1] = port->CRH;
+            Sim_OutMask[i] = gpio_output_mask(port);
+        }
+        out = Sim_OutMask[i];
+        port->IDR = (Sim_Input[i] & ~out) | (port->ODR & out);
+    }
+}
+
+// 外部输入变化：按AFIO_EXTICR选中的端口和EXTI边沿配置置位PR并挂起中断
+static void exti_sync(int port, uint16_t changed, uint16_t level)
+{
+    uint8_t line;
+    uint32_t bit;
+
+    for (line = 0; line < 16; line++)
+    {
+        bit = 1u << line;
+        if (!(changed & bit) || !(EXTI->IMR & bit))
+            continue;
+        if (((AFIO->EXTICR[line >> 2] >> ((line & 3) * 4)) & 0x0F) != (uint32_t)port)
+            continue;
+        if (!((level & bit) ? (EXTI->RTSR & bit) : (EXTI->FTSR & bit)))
+            continue;
+        EXTI->PR |= bit;
+        if (line == 1)
+            Sim_Pending |= 1u << SIM_IRQ_EXTI1;
+        else if (line == 4)
+            Sim_Pending |= 1u << SIM_IRQ_EXTI4;
+        else if (line >= 5 && line <= 9)
+            Sim_Pending |= 1u << SIM_IRQ_EXTI9_5;
+    }
+}
+
+void Sim_SetPin(GPIO_TypeDef *port, uint16_t pin, uint8_t level)
+{
+    int i = sim_port_index(port);
+    uint16_t old;
+
+    if (i < 0)
+        return;
+    old = Sim_Input[i];
+    if (level)
+        Sim_Input[i] |= pin;
+    else
+        Sim_Input[i] &= ~pin;
+    gpio_sync();
+    exti_sync(i, old ^ Sim_Input[i], Sim_Input[i]);
+}
+
+// 红外输出低电平表示有障碍
+void Sim_SetIR(uint8_t n, uint8_t obstacle)
+{
+    static const uint16_t pins[6] = {RED1_PIN, RED2_PIN, RED3_PIN, RED4_PIN, RED5_PIN, RED6_PIN};
+    if (n >= 1 && n <= 6)
+        Sim_SetPin(IR_PORT, pins[n - 1], !obstacle);
+}
+
+// ================= 超声波 (TIM1 + PB0/PB1 + EXTI1) =================
+#define SIM_NEVER ((uint64_t)-1)
+
+static uint64_t Tim1_Start = 0; // CNT=0的时刻
+static uint8_t Tim1_Running = 0;
+static uint64_t Tim1_NextUp = SIM_NEVER;
+static uint64_t Tim1_NextCc = SIM_NEVER;
+
+static float Sim_Distance = -1.0f;
+static uint64_t Echo_Rise = SIM_NEVER;
+static uint64_t Echo_Fall = SIM_NEVER;
+
+// 定时器计数周期 (us)，TIM1时钟72MHz
+static uint32_t tim1_tick_div(void)
+{
+    return TIM1->PSC + 1;
+}
+
+static uint64_t tim1_period(void)
+{
+    return (uint64_t)(TIM1->ARR + 1) * tim1_tick_div() / 72;
+}
+
+static void tim1_schedule(uint64_t cycle_start)
+{
+    Tim1_NextUp = cycle_start + tim1_period();
+    Tim1_NextCc = cycle_start + (uint64_t)TIM1->CCR1 * tim1_tick_div() / 72;
+    if (Tim1_NextCc <= Sim_Now)
+        Tim1_NextCc = SIM_NEVER; // 本周期的比较点已过
+}
+
+static void tim1_sync(void)
+{
+    uint64_t period;
+
+    if (!(TIM1->CR1 & TIM_CR1_CEN))
+    {
+        Tim1_Running = 0;
+        Tim1_NextUp = Tim1_NextCc = SIM_NEVER;
+        return;
+    }
+    if (!Tim1_Running)
+    {
+        Tim1_Running = 1;
+        Tim1_Start = Sim_Now - (uint64_t)TIM1->CNT * tim1_tick_div() / 72;
+        tim1_schedule(Tim1_Start);
+    }
+    period = tim1_period();
+    if (period)
+        TIM1->CNT = (uint16_t)((Sim_Now - Tim1_Start) % period * 72 / tim1_tick_div());
+}
+
+void Sim_SetDistance(float cm)
+{
+    Sim_Distance = cm;
+}
+
+// ECHO电平变化：更新PB1，EXTI1由Sim_SetPin()触发
+static void echo_set(uint8_t level)
+{
+    Sim_SetPin(GPIOB, GPIO_Pin_1, level);
+}
+
+// TRIG (PB0) 下降沿后安排回波
+static void trig_sync(void)
+{
+    uint16_t odr = GPIOB->ODR;
+    uint32_t width;
+
+    if ((Sim_LastOdr[1] & GPIO_Pin_0) && !(odr & GPIO_Pin_0) && Sim_Distance >= 0 && Echo_Rise == SIM_NEVER)
+    {
+        width = Sim_Distance > 400.0f ? SIM_ECHO_MAX_US : (uint32_t)(Sim_Distance / 0.017f);
+        Echo_Rise = Sim_Now + SIM_ECHO_DELAY_US;
+        Echo_Fall = Echo_Rise + width;
+    }
+}
+
+// ================= USART1 + DMA1通道4 =================
+static uint8_t Dma_Busy = 0;
+static uint64_t Dma_Done = SIM_NEVER;
+
+static char Rx_Queue[256];
+static uint16_t Rx_QHead = 0, Rx_QTail = 0;
+static uint64_t Rx_Next = SIM_NEVER;
+
+static void dma_sync(void)
+{
+    if (!Dma_Busy && (DMA1_Channel4->CCR & DMA_CCR1_EN) && DMA1_Channel4->CNDTR)
+    {
+        Dma_Busy = 1;
+        Dma_Done = Sim_Now + (uint64_t)DMA1_Channel4->CNDTR * SIM_UART_BYTE_US;
+    }
+}
+
+static void dma_complete(void)
+{
+    const uint8_t *src = (const uint8_t *)(uintptr_t)DMA1_Channel4->CMAR;
+
+    if (Sim_UartLog)
+        fwrite(src, 1, DMA1_Channel4->CNDTR, Sim_UartLog);
+    DMA1_Channel4->CNDTR = 0;
+    Dma_Busy = 0;
+    Dma_Done = SIM_NEVER;
+    DMA1->ISR |= DMA_ISR_GIF4 | DMA_ISR_TCIF4;
+    if (DMA1_Channel4->CCR & DMA_CCR1_TCIE)
+        Sim_Pending |= 1u << SIM_IRQ_DMA1_CH4;
+}
+
+// 向USART1接收端注入一行文本 (自动追加'\n')
+void Sim_UartInput(const char *text)
+{
+    while (1)
+    {
+        char c = *text ? *text++ : '\n';
+        uint16_t next = (Rx_QHead + 1) % sizeof(Rx_Queue);
+        if (next == Rx_QTail)
+            break;
+        Rx_Queue[Rx_QHead] = c;
+        Rx_QHead = next;
+        if (c == '\n')
+            break;
+    }
+    if (Rx_Next == SIM_NEVER)
+        Rx_Next = Sim_Now + SIM_UART_BYTE_US;
+}
+
+// 向USART1接收端注入原始字节 (可含0和换行)，返回放入的字节数，仿真队列满时截断
+uint16_t Sim_UartInputRaw(const uint8_t *data, uint16_t len)
+{
+    uint16_t n;
+
+    for (n = 0; n < len; n++)
+    {
+        uint16_t next = (Rx_QHead + 1) % sizeof(Rx_Queue);
+        if (next == Rx_QTail)
+            break;
+        Rx_Queue[Rx_QHead] = (char)data[n];
+        Rx_QHead = next;
+    }
+    if (n && Rx_Next == SIM_NEVER)
+        Rx_Next = Sim_Now + SIM_UART_BYTE_US;
+    return n;
+}
+
+// 仿真队列中尚未送到USART1的字节数
+uint16_t Sim_UartPending(void)
+{
+    return (uint16_t)((Rx_QHead + sizeof(Rx_Queue) - Rx_QTail) % sizeof(Rx_Queue));
+}
+
+static void rx_byte(void)
+{
+    if (USART1->SR & USART_SR_RXNE)
+        USART1->SR |= USART_SR_ORE; // 上一个字节还没被读走
+    USART1->DR = (uint8_t)Rx_Queue[Rx_QTail];
+    USART1->SR |= USART_SR_RXNE;
+    Rx_QTail = (Rx_QTail + 1) % sizeof(Rx_Queue);
+    Rx_Next = Rx_QTail != Rx_QHead ? Sim_Now + SIM_UART_BYTE_US : SIM_NEVER;
+    if (USART1->CR1 & USART_CR1_RXNEIE)
+        Sim_Pending |= 1u << SIM_IRQ_USART1;
+}
+
+// ================= 电机和编码器 =================
+static float Sim_Wheel[2];       // 左/右轮累计计数 (前进为正)
+static uint16_t Sim_LastCcr[4];
+
+// TIM2通道占空比 (0~1)
+float Sim_GetDuty(uint8_t channel)
+{
+    uint32_t ccr;
+    switch (channel)
+    {
+    case 1: ccr = TIM2->CCR1; break;
+    case 2: ccr = TIM2->CCR2; break;
+    case 3: ccr = TIM2->CCR3; break;
+    default: ccr = TIM2->CCR4; break;
+    }
+    if (ccr > TIM2->ARR + 1)
+        ccr = TIM2->ARR + 1;
+    return (float)ccr / (TIM2->ARR + 1);
+}
+
+// 单个车轮的有符号占空比 (前进为正)：右轮CH1前进/CH2后退，左轮CH4前进/CH3后退
+float Sim_GetWheelDuty(uint8_t right)
+{
+    return right ? Sim_GetDuty(1) - Sim_GetDuty(2) : Sim_GetDuty(4) - Sim_GetDuty(3);
+}
+
+// 单个车轮的两路输入是否都为低 (H桥高阻，电机惰行)
+int Sim_WheelCoast(uint8_t right)
+{
+    return right ? (TIM2->CCR1 == 0 && TIM2->CCR2 == 0) : (TIM2->CCR3 == 0 && TIM2->CCR4 == 0);
+}
+
+void Sim_MoveWheels(float left, float right)
+{
+    Sim_Wheel[0] += left;
+    Sim_Wheel[1] += right;
+}
+
+int32_t Sim_GetWheelCounts(uint8_t right)
+{
+    return (int32_t)Sim_Wheel[right ? 1 : 0];
+}
+
+// 默认被控对象：满占空比时每10ms约MOTOR_MAX_COUNTS个计数，时间常数30ms
+void Sim_WheelModel(void)
+{
+    static float speed[2]; // 计数/ms
+    uint8_t i;
+    float target;
+
+    for (i = 0; i < 2; i++)
+    {
+        target = Sim_GetWheelDuty(i) * MOTOR_MAX_COUNTS / 10.0f;
+        speed[i] += (target - speed[i]) * (1.0f / 30.0f);
+    }
+    Sim_MoveWheels(speed[0], speed[1]);
+}
+
+static void encoder_sync(void)
+{
+    TIM3->CNT = (uint16_t)((int32_t)Sim_Wheel[0] * ENCODER_LEFT_DIR);
+    TIM4->CNT = (uint16_t)((int32_t)Sim_Wheel[1] * ENCODER_RIGHT_DIR);
+}
+
+static void pwm_sync(void)
+{
+    uint16_t ccr[4] = {TIM2->CCR1, TIM2->CCR2, TIM2->CCR3, TIM2->CCR4};
+
+    if (memcmp(ccr, Sim_LastCcr, sizeof(ccr)) == 0)
+        return;
+    memcpy(Sim_LastCcr, ccr, sizeof(ccr));
+    if (Sim_PwmLog)
+        fprintf(Sim_PwmLog, "%llu,%u,%u,%u,%u\n", (unsigned long long)Sim_Now, ccr[0], ccr[1], ccr[2], ccr[3]);
+}
+
+// ================= DWT周期计数器 =================
+// 仿真时间不因计算而推进，只有读取计数器本身计入开销，使探针开销可以标定和检查
+static uint32_t Dwt_Probe_Cycles = 0;
+
+volatile uint32_t *Sim_DwtCyccnt(void)
+{
+    if (PROFILE_DWT_CTRL & PROFILE_DWT_CYCCNTENA)
+    {
+        DWT_CYCCNT_REG = (uint32_t)(Sim_Now * 72) + Dwt_Probe_Cycles;
+        Dwt_Probe_Cycles += SIM_DWT_READ_CYCLES;
+    }
+    return &DWT_CYCCNT_REG;
+}
+
+// ================= 时间推进 =================
+// 寄存器写入后的状态更新，不推进时间
+void Sim_Sync(void)
+{
+    uint32_t ticks;
+
+    gpio_sync();
+    trig_sync();
+    Sim_LastOdr[0] = GPIOA->ODR;
+    Sim_LastOdr[1] = GPIOB->ODR;
+    Sim_LastOdr[2] = GPIOC->ODR;
+    tim1_sync();
+    dma_sync();
+    encoder_sync();
+    pwm_sync();
+
+    // DWT周期计数器：按72MHz由仿真时间换算，加上探针读取的累计开销
+    if (PROFILE_DWT_CTRL & PROFILE_DWT_CYCCNTENA)
+        DWT_CYCCNT_REG = (uint32_t)(Sim_Now * 72) + Dwt_Probe_Cycles;
+
+    // SysTick向下计数，每1ms重装
+    ticks = SysTick->LOAD + 1;
+    SysTick->VAL = ticks - 1 - (uint32_t)(Sim_Now % 1000 * ticks / 1000);
+}
+
+static uint64_t sim_min(uint64_t a, uint64_t b)
+{
+    return a < b ? a : b;
+}
+
+// 处理时刻t (<= 目标时刻) 的事件
+static void sim_event(uint64_t t)
+{
+    Sim_Now = t;
+    Sim_Sync();
+
+    if (t % 1000 == 0)
+    {
+        Sim_PlantTick();
+        if ((SysTick->CTRL & SysTick_CTRL_ENABLE_Msk) && (SysTick->CTRL & SysTick_CTRL_TICKINT_Msk))
+            Sim_Pending |= 1u << SIM_IRQ_SYSTICK;
+    }
+    if (t == Tim1_NextCc)
+    {
+        Tim1_NextCc = SIM_NEVER;
+        TIM1->SR |= TIM_SR_CC1IF;
+        if (TIM1->DIER & TIM_DIER_CC1IE)
+            Sim_Pending |= 1u << SIM_IRQ_TIM1_CC;
+    }
+    if (t == Tim1_NextUp)
+    {
+        tim1_schedule(t);
+        TIM1->SR |= TIM_SR_UIF;
+        if (TIM1->DIER & TIM_DIER_UIE)
+            Sim_Pending |= 1u << SIM_IRQ_TIM1_UP;
+    }
+    if (t == Echo_Rise)
+    {
+        Echo_Rise = SIM_NEVER;
+        echo_set(1);
+    }
+    if (t == Echo_Fall)
+    {
+        Echo_Fall = SIM_NEVER;
+        echo_set(0);
+    }
+    if (t == Dma_Done)
+        dma_complete();
+    if (t == Rx_Next)
+        rx_byte();
+
+    Sim_Sync();
+    sim_deliver();
+}
+
+void Sim_Advance(uint32_t us)
+{
+    uint64_t target = Sim_Now + us;
+    uint64_t t;
+
+    // 固件刚写入的寄存器 (如启动DMA) 从当前时刻生效，不等到下一个事件
+    Sim_Sync();
+    while (1)
+    {
+        t = (Sim_Now / 1000 + 1) * 1000; // 下一个1ms节拍
+        t = sim_min(t, Tim1_NextUp);
+        t = sim_min(t, Tim1_NextCc);
+        t = sim_min(t, Echo_Rise);
+        t = sim_min(t, Echo_Fall);
+        t = sim_min(t, Dma_Done);
+        t = sim_min(t, Rx_Next);
+        t = sim_min(t, Sim_End);
+        if (t > target)
+            break;
+        if (t >= Sim_End)
+        {
+            Sim_Now = Sim_End;
+            exit(0);
+        }
+        sim_event(t);
+    }
+    Sim_Now = target;
+    Sim_Sync();
+    sim_deliver(); // 开中断后补执行挂起的中断
+}
+
+void Sim_Init(void)
+{
+    uint8_t i;
+    void *p;
+
+    for (i = 0; i < sizeof(Sim_Regions) / sizeof(Sim_Regions[0]); i++)
+    {
+        p = mmap((void *)(uintptr_t)Sim_Regions[i].Base, Sim_Regions[i].Size, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+        if (p != (void *)(uintptr_t)Sim_Regions[i].Base)
+        {
+            fprintf(stderr, "sim: cannot map 0x%08x\n", Sim_Regions[i].Base);
+            exit(2);
+        }
+        memset(p, Sim_Regions[i].Fill, Sim_Regions[i].Size);
+    }
+
+    // 上拉输入默认高电平 (红外无障碍)
+    for (i = 0; i < SIM_PORT_NUM; i++)
+        Sim_Input[i] = 0xFFFF;
+    Sim_Input[1] &= ~GPIO_Pin_1; // ECHO下拉
+    USART1->SR = USART_SR_TXE | USART_SR_TC;
+}
@@ -0,0 +1,53 @@
+#ifndef __SIM_H
+#define __SIM_H
+
+#include <stdio.h>
+#include "stm32f10x.h"
+
+/*
+ * 主机端寄存器级外设仿真：
+ * 把Flash、外设区和Cortex-M3内核外设的地址区间映射为主机内存，
+ * 固件和标准库照常读写寄存器；仿真器在时间推进时解释这些寄存器
+ * (GPIO置位/复位、TIM1定时与比较、EXTI、SysTick、DMA1通道4串口发送、
+ * USART1接收)，并在允许时调用对应的中断函数。
+ * 时间只在 Delay_us/Delay_ms 和每次读取 micros/millis 时推进，
+ * 与主机运行速度无关，结果可重复。
+ */
+
+#define SIM_POLL_US 1            // 每次读取时钟计入的CPU时间 (us)
+#define SIM_DWT_READ_CYCLES 3    // 每次读取DWT_CYCCNT计入的周期 (取地址+LDR)
+#define SIM_UART_BYTE_US 87      // 115200bps下一个字节的传输时间 (us)
+#define SIM_ECHO_DELAY_US 500    // TRIG结束到ECHO上升沿的延时 (us)
+#define SIM_ECHO_MAX_US 38000    // 超出量程时的回波宽度 (us)
+
+extern uint64_t Sim_Now;         // 仿真时间 (us)
+extern uint64_t Sim_End;         // 结束时间 (us)
+extern FILE *Sim_PwmLog;         // TIM2比较值变化记录 (CSV)
+extern FILE *Sim_UartLog;        // USART1发送的原始字节
+
+// 每1ms在SysTick之前调用一次，负责更新编码器、红外、测距等输入
+// 默认为 Sim_WheelModel (一阶惯性的电机模型，不含车体运动)
+extern void (*Sim_PlantTick)(void);
+
+void Sim_Init(void);
+void Sim_Advance(uint32_t us);
+void Sim_Sync(void);
+
+// 输入
+void Sim_SetPin(GPIO_TypeDef *port, uint16_t pin, uint8_t level);
+void Sim_SetIR(uint8_t n, uint8_t obstacle);
+void Sim_SetDistance(float cm);
+void Sim_MoveWheels(float left, float right);
+void Sim_UartInput(const char *text);
+uint16_t Sim_UartInputRaw(const uint8_t *data, uint16_t len);
+uint16_t Sim_UartPending(void);
+
+// 输出
+float Sim_GetDuty(uint8_t channel);
+float Sim_GetWheelDuty(uint8_t right);
+int Sim_WheelCoast(uint8_t right);
+int32_t Sim_GetWheelCounts(uint8_t right);
+
+void Sim_WheelModel(void);
+
+#endif
@@ -0,0 +1,53 @@
+#include "stm32f10x_crc.h"
+
+/*
+ * stm32f10x_crc.c 的仿真版本：CRC单元靠写DR触发计算，寄存器内存模型无法表达，
+ * 改为软件实现同样的算法 (CRC-32/MPEG-2：多项式0x04C11DB7，初值全1，按32位字高位先行)。
+ */
+
+static uint32_t Sim_Crc = 0xFFFFFFFF;
+
+static uint32_t crc_word(uint32_t crc, uint32_t data)
+{
+    uint8_t i;
+
+    crc ^= data;
+    for (i = 0; i < 32; i++)
+        crc = (crc & 0x80000000) ? (crc << 1) ^ 0x04C11DB7 : crc << 1;
+    return crc;
+}
+
+void CRC_ResetDR(void)
+{
+    Sim_Crc = 0xFFFFFFFF;
+}
+
+uint32_t CRC_CalcCRC(uint32_t Data)
+{
+    Sim_Crc = crc_word(Sim_Crc, Data);
+    return Sim_Crc;
+}
+
+uint32_t CRC_CalcBlockCRC(uint32_t pBuffer[], uint32_t BufferLength)
+{
+    uint32_t i;
+
+    for (i = 0; i < BufferLength; i++)
+        Sim_Crc = crc_word(Sim_Crc, pBuffer[i]);
+    return Sim_Crc;
+}
+
+uint32_t CRC_GetCRC(void)
+{
+    return Sim_Crc;
+}
+
+void CRC_SetIDRegister(uint8_t IDValue)
+{
+    CRC->IDR = IDValue;
+}
+
+uint8_t CRC_GetIDRegister(void)
+{
+    return CRC->IDR;
+}
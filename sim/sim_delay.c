@@ -0,0 +1,47 @@
+#include "delay.h"
+#include "sim.h"
+
+/*
+ * delay.c 的仿真版本：时间由仿真器维护，
+ * 延时函数直接推进仿真时间，读取时钟时计入一次轮询的CPU时间。
+ */
+
+void delay_init(void)
+{
+    SysTick->LOAD = 9000 - 1; // HCLK/8 = 9MHz，1ms
+    SysTick->VAL = 0;
+    NVIC_SetPriority(SysTick_IRQn, 2 << 2);
+    SysTick->CTRL |= SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+}
+
+// 毫秒数直接由仿真时间得出
+void Delay_IncTick(void)
+{
+}
+
+uint32_t millis(void)
+{
+    Sim_Advance(SIM_POLL_US);
+    return (uint32_t)(Sim_Now / 1000);
+}
+
+uint32_t micros(void)
+{
+    Sim_Advance(SIM_POLL_US);
+    return (uint32_t)Sim_Now;
+}
+
+void Delay_us(uint32_t xus)
+{
+    Sim_Advance(xus);
+}
+
+void Delay_ms(uint32_t xms)
+{
+    Sim_Advance(xms * 1000);
+}
+
+void Delay_s(uint32_t xs)
+{
+    Sim_Advance(xs * 1000000);
+}
@@ -0,0 +1,231 @@
+#undef main
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+#include "Scheduler.h"
+#include "Serial.h"
+#include "Encoder.h"
+#include "oled.h"
+#include "world.h"
+#include "Profile.h"
+#include "Latency.h"
+
+/*
+ * 仿真入口：初始化寄存器模型，读取脚本，然后运行固件的main()。
+ * 固件的main在编译时改名为Firmware_Main (-Dmain=Firmware_Main)，
+ * 仿真时间到达后在时间推进中退出，退出时打印统计。
+ */
+
+int Firmware_Main(void);
+
+// 脚本：每行 "<时间ms> <命令> <参数>"，按时间顺序排列
+#define SCRIPT_MAX 256
+#define SCRIPT_TEXT 48
+
+typedef struct
+{
+    uint32_t Ms;
+    char Cmd[8];
+    char Arg[SCRIPT_TEXT];
+} Script_Line;
+
+static Script_Line Script[SCRIPT_MAX];
+static int Script_Num = 0, Script_Pos = 0;
+static const char *Out_Prefix = "sim";
+static int Use_World = 0;
+
+// 调度器任务表 (链接时用 --wrap=Scheduler_Init 截获)
+static Scheduler_Task *Sim_Tasks = 0;
+static uint8_t Sim_TaskNum = 0;
+
+void __real_Scheduler_Init(Scheduler_Task *tasks, uint8_t count, uint32_t (*clock)(void));
+
+void __wrap_Scheduler_Init(Scheduler_Task *tasks, uint8_t count, uint32_t (*clock)(void))
+{
+    Sim_Tasks = tasks;
+    Sim_TaskNum = count;
+    __real_Scheduler_Init(tasks, count, clock);
+}
+
+static void script_load(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    char line[128];
+    Script_Line *s;
+    int n;
+
+    if (!f)
+    {
+        fprintf(stderr, "sim: cannot open %s\n", path);
+        exit(2);
+    }
+    while (fgets(line, sizeof(line), f) && Script_Num < SCRIPT_MAX)
+    {
+        char *hash = strchr(line, '#');
+        if (hash)
+            *hash = 0;
+        s = &Script[Script_Num];
+        s->Arg[0] = 0;
+        n = sscanf(line, "%u %7s %47[^\n]", &s->Ms, s->Cmd, s->Arg);
+        if (n >= 2)
+            Script_Num++;
+    }
+    fclose(f);
+}
+
+static void script_run(const Script_Line *s)
+{
+    int n, v;
+    float cm;
+
+    if (strcmp(s->Cmd, "ir") == 0 && sscanf(s->Arg, "%d %d", &n, &v) == 2)
+        Sim_SetIR((uint8_t)n, (uint8_t)v);
+    else if (strcmp(s->Cmd, "dist") == 0 && sscanf(s->Arg, "%f", &cm) == 1)
+        Sim_SetDistance(cm);
+    else if (strcmp(s->Cmd, "rx") == 0)
+        Sim_UartInput(s->Arg);
+    else if (strcmp(s->Cmd, "end") == 0)
+        Sim_End = Sim_Now;
+    else
+        fprintf(stderr, "sim: bad script line at %u ms: %s %s\n", s->Ms, s->Cmd, s->Arg);
+}
+
+// 每1ms：执行到期的脚本行，再推进被控对象 (有地图时为整车模型)
+static void script_tick(void)
+{
+    while (Script_Pos < Script_Num && Script[Script_Pos].Ms * 1000ULL <= Sim_Now)
+        script_run(&Script[Script_Pos++]);
+    if (Use_World)
+        World_Tick();
+    else
+        Sim_WheelModel();
+}
+
+static FILE *open_out(const char *suffix, const char *mode)
+{
+    char path[256];
+    FILE *f;
+
+    snprintf(path, sizeof(path), "%s_%s", Out_Prefix, suffix);
+    f = fopen(path, mode);
+    if (!f)
+    {
+        fprintf(stderr, "sim: cannot create %s\n", path);
+        exit(2);
+    }
+    return f;
+}
+
+// 显存保存为PBM图片
+static void dump_oled(void)
+{
+    const uint8_t *buf = OLED_GetBuffer();
+    FILE *f = open_out("oled.pbm", "w");
+    int x, y;
+
+    fprintf(f, "P1\n%d %d\n", OLED_WIDTH, OLED_PAGES * 8);
+    for (y = 0; y < OLED_PAGES * 8; y++)
+    {
+        for (x = 0; x < OLED_WIDTH; x++)
+            fputc((buf[(y / 8) * OLED_WIDTH + x] >> (y % 8)) & 1 ? '1' : '0', f);
+        fputc('\n', f);
+    }
+    fclose(f);
+}
+
+// 打印一个时间直方图 (只列出非空的档)
+static void print_hist(const char *name, const Latency_Hist *h)
+{
+    int k;
+
+    printf("%s: count %u max %u us\n", name, h->Count, h->Max);
+    for (k = 0; k < LATENCY_BINS; k++)
+    {
+        if (h->Bins[k])
+            printf("  >= %8u us: %u\n", k ? 1u << k : 0, h->Bins[k]);
+    }
+}
+
+static void report(void)
+{
+    uint8_t i;
+    Scheduler_Task *t;
+
+    if (Sim_PwmLog)
+        fclose(Sim_PwmLog);
+    if (Sim_UartLog)
+        fclose(Sim_UartLog);
+    if (World_PathLog)
+        fclose(World_PathLog);
+    dump_oled();
+
+    printf("sim time: %.3f s\n", Sim_Now / 1e6);
+    printf("%-8s %8s %8s %8s %10s\n", "task", "period", "runs", "overrun", "wcet_us");
+    for (i = 0; i < Sim_TaskNum; i++)
+    {
+        t = &Sim_Tasks[i];
+        printf("%-8s %8u %8u %8u %10u\n", t->Name, t->Period, t->RunCount, t->Overrun, t->WCET);
+    }
+    printf("%-8s %8s %8s %8s %8s\n", "region", "count", "min", "max", "mean");
+    for (i = 0; i < PROF_NUM; i++)
+    {
+        const Profile_Region *r = Profile_Get(i);
+        printf("%-8s %8u %8u %8u %8u\n", r->Name, r->Count, r->Min, r->Max, Profile_Mean(r));
+    }
+    print_hist("loop period", Latency_Get(LATENCY_LOOP));
+    print_hist("reaction", Latency_Get(LATENCY_REACT));
+    printf("encoder: left %d right %d\n", Encoder_GetLeft(), Encoder_GetRight());
+    printf("serial: dropped %u rx_overrun %u\n", Serial_GetDropped(), Serial_GetRxOverrun());
+    if (Use_World)
+        World_Report(stdout);
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: sim_car [-t seconds] [-s script] [-m map] [-o out_prefix]\n");
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    int i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (i + 1 >= argc)
+            usage();
+        if (strcmp(argv[i], "-t") == 0)
+            Sim_End = (uint64_t)(atof(argv[++i]) * 1e6);
+        else if (strcmp(argv[i], "-s") == 0)
+            script_load(argv[++i]);
+        else if (strcmp(argv[i], "-m") == 0)
+        {
+            if (!World_Load(argv[++i]))
+            {
+                fprintf(stderr, "sim: cannot open %s\n", argv[i]);
+                exit(2);
+            }
+            Use_World = 1;
+        }
+        else if (strcmp(argv[i], "-o") == 0)
+            Out_Prefix = argv[++i];
+        else
+            usage();
+    }
+
+    Sim_Init();
+    Sim_PlantTick = script_tick;
+    Sim_PwmLog = open_out("pwm.csv", "w");
+    fprintf(Sim_PwmLog, "time_us,ccr1,ccr2,ccr3,ccr4\n");
+    Sim_UartLog = open_out("uart.bin", "wb");
+    if (Use_World)
+    {
+        World_PathLog = open_out("path.csv", "w");
+        fprintf(World_PathLog, "time_s,x_cm,y_cm,heading_deg,contact\n");
+    }
+    atexit(report);
+
+    Firmware_Main();
+    return 0;
+}
@@ -0,0 +1,22 @@
+#ifndef __SIM_STM32F10X_H
+#define __SIM_STM32F10X_H
+
+/*
+ * 主机仿真用的器件头文件：仿真编译时 -Isim 放在 -Istart 之前，
+ * 固件和标准库中的 #include "stm32f10x.h" 都会先找到这里。
+ * 寄存器定义直接沿用原头文件 (外设地址由 sim.c 映射为主机内存)，
+ * 只把GCC分支中的Cortex-M3汇编指令换成C实现。
+ */
+#include "../start/stm32f10x.h"
+
+void Sim_DisableIrq(void);
+void Sim_EnableIrq(void);
+
+#define __disable_irq() Sim_DisableIrq()
+#define __enable_irq() Sim_EnableIrq()
+
+// DWT周期计数器：每次访问先按仿真时间更新，再计入一次读取的开销 (见sim.c)
+volatile uint32_t *Sim_DwtCyccnt(void);
+#define PROFILE_DWT_CYCCNT (*Sim_DwtCyccnt())
+
+#endif
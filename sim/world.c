@@ -0,0 +1,311 @@
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "sim.h"
+#include "world.h"
+#include "Encoder.h"
+#include "motor.h"
+
+#define WORLD_DT 0.001f        // 步长 (s)，与SysTick同步
+#define WORLD_G 981.0f         // 重力加速度 (cm/s^2)
+#define WORLD_STOP_SPEED 1.0f  // 低于此轮速视为静止 (cm/s)
+#define WORLD_ULTRA_RAYS 7     // 超声波锥内的射线数
+#define WORLD_ULTRA_MAX 400.0f // 超声波量程 (cm)
+#define WORLD_PI 3.14159265f
+#define DEG2RAD(d) ((d) * WORLD_PI / 180.0f)
+
+World_State World;
+FILE *World_PathLog = 0;
+
+// 传感器在车体坐标系中的位置和朝向 (度)
+typedef struct
+{
+    float X, Y, Angle;
+} World_Sensor;
+
+static const World_Sensor World_IR[6] = {
+    {8.0f, 4.0f, 15.0f},   // RED1 前方左侧
+    {8.0f, -4.0f, -15.0f}, // RED2 前方右侧
+    {5.0f, 7.0f, 90.0f},   // RED3 左侧前
+    {5.0f, -7.0f, -90.0f}, // RED4 右侧前
+    {-5.0f, 7.0f, 90.0f},  // RED5 左侧后
+    {-5.0f, -7.0f, -90.0f} // RED6 右侧后
+};
+static const World_Sensor World_Ultra = {9.0f, 0.0f, 0.0f};
+
+static void world_defaults(void)
+{
+    memset(&World, 0, sizeof(World));
+    World.VMax = MOTOR_MAX_COUNTS * (1000.0f / MOTOR_SPEED_WINDOW) / ENCODER_COUNTS_PER_CM;
+    World.Tau = 0.03f;
+    World.Mu = 0.6f;
+    World.Slip = 0.02f;
+    World.Coast = 200.0f;
+    World.Radius = 9.0f;
+    World.IrRange = 10.0f;
+    World.UltraCone = 15.0f;
+    World.GoalTime = -1.0f;
+}
+
+static void world_add_wall(float x1, float y1, float x2, float y2)
+{
+    World_Wall *w;
+
+    if (World.WallNum >= WORLD_MAX_WALLS)
+        return;
+    w = &World.Walls[World.WallNum++];
+    w->X1 = x1;
+    w->Y1 = y1;
+    w->X2 = x2;
+    w->Y2 = y2;
+}
+
+static void world_add_box(float x1, float y1, float x2, float y2)
+{
+    world_add_wall(x1, y1, x2, y1);
+    world_add_wall(x2, y1, x2, y2);
+    world_add_wall(x2, y2, x1, y2);
+    world_add_wall(x1, y2, x1, y1);
+}
+
+/*
+ * 地图文件：每行一条，#后为注释，单位cm/度
+ *   size <宽> <高>          四周围墙 [0,宽]x[0,高]
+ *   wall <x1> <y1> <x2> <y2>  线段墙
+ *   box <x1> <y1> <x2> <y2>   矩形障碍
+ *   start <x> <y> <朝向>     起点
+ *   goal <x> <y> <半径>      终点区域，到达即结束
+ *   vmax/tau/mu/slip/coast/radius/ir/cone <值>  覆盖模型参数
+ */
+int World_Load(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    char line[128], key[16];
+    float a[4];
+    int n, lineno = 0;
+
+    if (!f)
+        return 0;
+    world_defaults();
+    while (fgets(line, sizeof(line), f))
+    {
+        char *hash = strchr(line, '#');
+        lineno++;
+        if (hash)
+            *hash = 0;
+        n = sscanf(line, "%15s %f %f %f %f", key, &a[0], &a[1], &a[2], &a[3]);
+        if (n <= 0)
+            continue;
+        n--;
+        if (strcmp(key, "size") == 0 && n == 2)
+            world_add_box(0, 0, a[0], a[1]);
+        else if (strcmp(key, "wall") == 0 && n == 4)
+            world_add_wall(a[0], a[1], a[2], a[3]);
+        else if (strcmp(key, "box") == 0 && n == 4)
+            world_add_box(a[0], a[1], a[2], a[3]);
+        else if (strcmp(key, "start") == 0 && n == 3)
+        {
+            World.X = a[0];
+            World.Y = a[1];
+            World.Theta = DEG2RAD(a[2]);
+        }
+        else if (strcmp(key, "goal") == 0 && n == 3)
+        {
+            World.GoalX = a[0];
+            World.GoalY = a[1];
+            World.GoalR = a[2];
+        }
+        else if (strcmp(key, "vmax") == 0 && n == 1)
+            World.VMax = a[0];
+        else if (strcmp(key, "tau") == 0 && n == 1)
+            World.Tau = a[0];
+        else if (strcmp(key, "mu") == 0 && n == 1)
+            World.Mu = a[0];
+        else if (strcmp(key, "slip") == 0 && n == 1)
+            World.Slip = a[0];
+        else if (strcmp(key, "coast") == 0 && n == 1)
+            World.Coast = a[0];
+        else if (strcmp(key, "radius") == 0 && n == 1)
+            World.Radius = a[0];
+        else if (strcmp(key, "ir") == 0 && n == 1)
+            World.IrRange = a[0];
+        else if (strcmp(key, "cone") == 0 && n == 1)
+            World.UltraCone = a[0];
+        else
+            fprintf(stderr, "world: %s:%d: bad line\n", path, lineno);
+    }
+    fclose(f);
+    return 1;
+}
+
+// 射线与所有墙的最近交点距离，无交点返回max
+static float world_ray(float ox, float oy, float angle, float max)
+{
+    float dx = cosf(angle), dy = sinf(angle);
+    float ex, ey, px, py, den, t, u, best = max;
+    int i;
+
+    for (i = 0; i < World.WallNum; i++)
+    {
+        ex = World.Walls[i].X2 - World.Walls[i].X1;
+        ey = World.Walls[i].Y2 - World.Walls[i].Y1;
+        den = dx * ey - dy * ex;
+        if (fabsf(den) < 1e-6f)
+            continue;
+        px = World.Walls[i].X1 - ox;
+        py = World.Walls[i].Y1 - oy;
+        t = (px * ey - py * ex) / den;
+        u = (px * dy - py * dx) / den;
+        if (t >= 0 && u >= 0 && u <= 1 && t < best)
+            best = t;
+    }
+    return best;
+}
+
+// 传感器射线 (offset为相对传感器朝向的附加角度，度)
+static float world_sense(const World_Sensor *s, float offset, float max)
+{
+    float c = cosf(World.Theta), si = sinf(World.Theta);
+    float ox = World.X + c * s->X - si * s->Y;
+    float oy = World.Y + si * s->X + c * s->Y;
+    return world_ray(ox, oy, World.Theta + DEG2RAD(s->Angle + offset), max);
+}
+
+// 点到线段的距离
+static float world_seg_dist(float x, float y, const World_Wall *w)
+{
+    float ex = w->X2 - w->X1, ey = w->Y2 - w->Y1;
+    float len2 = ex * ex + ey * ey;
+    float t = len2 > 0 ? ((x - w->X1) * ex + (y - w->Y1) * ey) / len2 : 0;
+
+    if (t < 0)
+        t = 0;
+    else if (t > 1)
+        t = 1;
+    ex = w->X1 + t * ex - x;
+    ey = w->Y1 + t * ey - y;
+    return sqrtf(ex * ex + ey * ey);
+}
+
+static int world_collide(float x, float y)
+{
+    int i;
+    for (i = 0; i < World.WallNum; i++)
+    {
+        if (world_seg_dist(x, y, &World.Walls[i]) < World.Radius)
+            return 1;
+    }
+    return 0;
+}
+
+static void world_sensors(void)
+{
+    float d, best;
+    int i;
+
+    for (i = 0; i < 6; i++)
+    {
+        d = world_sense(&World_IR[i], 0, World.IrRange);
+        Sim_SetIR(i + 1, d < World.IrRange);
+    }
+
+    // 超声波取锥内最近的反射
+    best = WORLD_ULTRA_MAX + 1;
+    for (i = 0; i < WORLD_ULTRA_RAYS; i++)
+    {
+        d = world_sense(&World_Ultra, World.UltraCone * (2.0f * i / (WORLD_ULTRA_RAYS - 1) - 1.0f), best);
+        if (d < best)
+            best = d;
+    }
+    Sim_SetDistance(best);
+}
+
+void World_Tick(void)
+{
+    float target, dv, amax = World.Mu * WORLD_G * WORLD_DT, coast = World.Coast * WORLD_DT;
+    float v, w, nx, ny;
+    int i;
+
+    // 电机：一阶惯性 (两路全高刹车时按同一时间常数衰减到0)，两路都为低时惰行，只受摩擦减速；
+    // 车轮对地速度受附着力限制，并有固定比例的打滑
+    for (i = 0; i < 2; i++)
+    {
+        if (Sim_WheelCoast(i))
+        {
+            if (World.Wheel[i] > coast)
+                World.Wheel[i] -= coast;
+            else if (World.Wheel[i] < -coast)
+                World.Wheel[i] += coast;
+            else
+                World.Wheel[i] = 0;
+        }
+        else
+            World.Wheel[i] += (Sim_GetWheelDuty(i) * World.VMax - World.Wheel[i]) * WORLD_DT / World.Tau;
+        target = World.Wheel[i] * (1.0f - World.Slip);
+        dv = target - World.Ground[i];
+        if (dv > amax)
+            dv = amax;
+        else if (dv < -amax)
+            dv = -amax;
+        World.Ground[i] += dv;
+    }
+    // 编码器记录的是车轮转动，不受打滑和碰撞影响
+    Sim_MoveWheels(World.Wheel[0] * WORLD_DT * ENCODER_COUNTS_PER_CM, World.Wheel[1] * WORLD_DT * ENCODER_COUNTS_PER_CM);
+
+    // 差速运动学
+    v = (World.Ground[0] + World.Ground[1]) * 0.5f;
+    w = (World.Ground[1] - World.Ground[0]) / TRACK_WIDTH_CM;
+    nx = World.X + v * cosf(World.Theta) * WORLD_DT;
+    ny = World.Y + v * sinf(World.Theta) * WORLD_DT;
+    World.Theta += w * WORLD_DT;
+    if (World.Theta > WORLD_PI)
+        World.Theta -= 2 * WORLD_PI;
+    else if (World.Theta < -WORLD_PI)
+        World.Theta += 2 * WORLD_PI;
+
+    // 碰到墙时车体不再平移 (车轮原地打滑)，仍可原地转动
+    if (world_collide(nx, ny))
+    {
+        if (!World.Contact)
+            World.Collisions++;
+        World.Contact = 1;
+        World.ContactTime += WORLD_DT;
+    }
+    else
+    {
+        World.Contact = 0;
+        World.Distance += fabsf(v) * WORLD_DT;
+        World.X = nx;
+        World.Y = ny;
+    }
+    if (fabsf(World.Ground[0]) < WORLD_STOP_SPEED && fabsf(World.Ground[1]) < WORLD_STOP_SPEED)
+        World.StoppedTime += WORLD_DT;
+
+    world_sensors();
+
+    if (World_PathLog && Sim_Now % 10000 == 0)
+        fprintf(World_PathLog, "%.3f,%.2f,%.2f,%.1f,%d\n", Sim_Now / 1e6, World.X, World.Y,
+                World.Theta * 180.0f / WORLD_PI, World.Contact);
+
+    if (World.GoalR > 0 && World.GoalTime < 0 &&
+        hypotf(World.X - World.GoalX, World.Y - World.GoalY) < World.GoalR)
+    {
+        World.GoalTime = Sim_Now / 1e6f;
+        Sim_End = Sim_Now;
+    }
+}
+
+void World_Report(FILE *out)
+{
+    if (World.GoalR > 0)
+    {
+        if (World.GoalTime >= 0)
+            fprintf(out, "goal: reached at %.3f s\n", World.GoalTime);
+        else
+            fprintf(out, "goal: not reached\n");
+    }
+    fprintf(out, "collisions: %u (contact %.3f s)\n", World.Collisions, World.ContactTime);
+    fprintf(out, "distance: %.1f cm\n", World.Distance);
+    fprintf(out, "stopped: %.3f s\n", World.StoppedTime);
+    fprintf(out, "final pose: x %.1f y %.1f heading %.1f\n", World.X, World.Y, World.Theta * 180.0f / WORLD_PI);
+}
@@ -0,0 +1,57 @@
+#ifndef __WORLD_H
+#define __WORLD_H
+
+#include <stdio.h>
+
+/*
+ * 二维差速小车仿真：每1ms由TIM2占空比推进电机和车体，
+ * 按场地地图对红外和超声波做射线检测，写回GPIO/回波/编码器，并统计指标。
+ * 坐标单位cm，角度逆时针为正；车体坐标系x向前、y向左。
+ */
+
+#define WORLD_MAX_WALLS 128
+
+typedef struct
+{
+    float X1, Y1, X2, Y2;
+} World_Wall;
+
+typedef struct
+{
+    // 场地
+    World_Wall Walls[WORLD_MAX_WALLS];
+    int WallNum;
+    float GoalX, GoalY, GoalR; // 终点区域 (GoalR<=0 表示无终点)
+
+    // 模型参数 (可在地图文件中覆盖)
+    float VMax;     // 满占空比时的轮速 (cm/s)
+    float Tau;      // 电机时间常数 (s)
+    float Mu;       // 地面附着系数，限制车轮对地加速度
+    float Slip;     // 打滑比例：车轮对地速度 = 轮速 * (1 - Slip)
+    float Coast;    // 惰行 (两路输入都为低) 时的摩擦减速度 (cm/s^2)
+    float Radius;   // 车体碰撞半径 (cm)
+    float IrRange;  // 红外检测距离 (cm)
+    float UltraCone; // 超声波半锥角 (度)
+
+    // 状态
+    float X, Y, Theta;     // 车体中心位置和朝向
+    float Wheel[2];        // 左/右轮轮速 (cm/s)
+    float Ground[2];       // 左/右轮对地速度 (cm/s)
+    int Contact;           // 当前是否与墙接触
+
+    // 指标
+    unsigned Collisions;   // 碰撞次数 (进入接触的次数)
+    float ContactTime;     // 接触时间 (s)
+    float Distance;        // 行驶路程 (cm)
+    float StoppedTime;     // 静止时间 (s)
+    float GoalTime;        // 到达终点的时刻 (s)，<0 表示未到达
+} World_State;
+
+extern World_State World;
+extern FILE *World_PathLog; // 轨迹记录 (CSV，每10ms一行)
+
+int World_Load(const char *path);
+void World_Tick(void);
+void World_Report(FILE *out);
+
+#endif
@@ -0,0 +1,53 @@
+#!/bin/sh
+# 主机测试：在仓库根目录执行 sh tests/run.sh [测试名...]，全部通过时返回0
+# 纯算法测试只编译被测模块；test_sim_* 链接全部固件和 sim/ 寄存器模型 (需要 -no-pie)
+
+CC=${CC:-gcc}
+OUT=${OUT:-/tmp/car_tests}
+CFLAGS="-std=gnu99 -O2 -g -no-pie -DSTM32F10X_MD -DUSE_STDPERIPH_DRIVER -Itests -Isim -Istart -Ilibrary -Iuser -I."
+
+FIRMWARE="main.c motor.c Encoder.c Ultrasound.c Ranging.c Brake.c IRSensor.c Avoid.c Maneuver.c Scheduler.c \
+PID.c Param.c AutoTune.c oled.c Serial.c Telemetry.c Command.c Format.c Profile.c Latency.c user/stm32f10x_it.c"
+LIB="library/misc.c library/stm32f10x_gpio.c library/stm32f10x_rcc.c library/stm32f10x_tim.c \
+library/stm32f10x_exti.c library/stm32f10x_usart.c library/stm32f10x_dma.c library/stm32f10x_flash.c \
+library/stm32f10x_i2c.c"
+SIM="sim/sim.c sim/sim_delay.c sim/sim_crc.c sim/world.c"
+
+# 各测试的源文件 (测试文件本身除外)
+sources()
+{
+    case $1 in
+    test_maneuver) echo "Maneuver.c" ;;
+    test_scheduler) echo "Scheduler.c" ;;
+    test_autotune) echo "AutoTune.c" ;;
+    test_pid) echo "PID.c" ;;
+    test_ranging) echo "Ranging.c" ;;
+    test_pid_example) echo "example/PID_encoder_motor/Hardware/PID.c" ;;
+    test_sim_brake) echo "-DBRAKE_MODE=BRAKE_REVERSE -Dmain=Firmware_Main $FIRMWARE $LIB $SIM" ;;
+    test_sim_oled) echo "-DOLED_USE_HW_I2C=0 -Dmain=Firmware_Main $FIRMWARE $LIB $SIM" ;;
+    test_sim_*) echo "-Dmain=Firmware_Main $FIRMWARE $LIB $SIM" ;;
+    esac
+}
+
+mkdir -p "$OUT"
+cd "$(dirname "$0")/.." || exit 2
+
+if [ $# -eq 0 ]; then
+    set -- $(ls tests/test_*.c | sed 's|tests/||; s|\.c$||')
+fi
+
+failed=0
+for name in "$@"; do
+    if ! $CC $CFLAGS tests/$name.c $(sources $name) -lm -o "$OUT/$name" 2>"$OUT/$name.log"; then
+        echo "$name: build failed"
+        cat "$OUT/$name.log"
+        failed=$((failed + 1))
+        continue
+    fi
+    if ! "$OUT/$name"; then
+        failed=$((failed + 1))
+    fi
+done
+
+echo "failed: $failed"
+[ $failed -eq 0 ]
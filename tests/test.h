@@ -0,0 +1,43 @@
+#ifndef __TEST_H
+#define __TEST_H
+
+#include <stdio.h>
+#include <math.h>
+
+/*
+ * 主机测试用的最小断言：失败时打印位置并计数，不中止，
+ * main末尾 return TEST_DONE(); 有失败时返回1。
+ */
+
+static int Test_Checks = 0;
+static int Test_Failures = 0;
+
+#define CHECK(cond)                                                              \
+    do                                                                           \
+    {                                                                            \
+        Test_Checks++;                                                           \
+        if (!(cond))                                                             \
+        {                                                                        \
+            Test_Failures++;                                                     \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond);      \
+        }                                                                        \
+    } while (0)
+
+#define CHECK_NEAR(actual, expected, tol)                                        \
+    do                                                                           \
+    {                                                                            \
+        double a_ = (actual), e_ = (expected);                                   \
+        Test_Checks++;                                                           \
+        if (!(fabs(a_ - e_) <= (tol)))                                           \
+        {                                                                        \
+            Test_Failures++;                                                     \
+            printf("%s:%d: %s = %g, expected %g +- %g\n", __FILE__, __LINE__,    \
+                   #actual, a_, e_, (double)(tol));                              \
+        }                                                                        \
+    } while (0)
+
+#define TEST_DONE()                                                              \
+    (printf("%s: %d checks, %d failed\n", __FILE__, Test_Checks, Test_Failures), \
+     Test_Failures ? 1 : 0)
+
+#endif
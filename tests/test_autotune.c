@@ -0,0 +1,224 @@
+#include <math.h>
+#include "test.h"
+#include "AutoTune.h"
+#include "motor.h"
+#include "Param.h"
+#include "delay.h"
+
+/*
+ * 继电器自整定 (user-012)：对象为一阶惯性加纯滞后 (FOPDT)
+ *   T*dy/dt = K*u(t-L) - y，速度%对占空比%
+ * 以0.1ms步长积分，继电器每MOTOR_PID_DIV ms采样一次 (零阶保持)，检查
+ * - 极限环的振幅和周期与FOPDT继电器振荡的解析解一致
+ *   (采样使切换平均晚半个采样周期，解析解中的滞后取 L + dt/2)
+ * - 固件算出的Ku、Tu与按解析极限环换算的值一致
+ * - 与对象真正的临界增益/周期 (频率响应解析值) 相比，Ku偏小、Tu偏大，整定结果偏保守：
+ *   滞环使振荡相位超前asin(eps/a)、频率低于临界频率，且方波输入下的波形不是正弦，
+ *   本对象 (L/T约0.35, eps/a约0.3) 偏差约30%，检查偏差在BIAS_MAX以内
+ * - AutoTune_Run在同一对象上整定成功，写入的参数与Tyreus-Luyben公式一致
+ * - 写Flash前的检查：超出串口命令范围、NaN或两轮相差过大的参数不通过
+ */
+
+#define PLANT_K 1.0f   // 对象增益：振荡中心 = K * BIAS = SETPOINT
+#define PLANT_T 0.1f   // 时间常数 (s)
+#define PLANT_L 0.03f  // 纯滞后 (s)
+#define SIM_DT 1e-4f   // 积分步长 (s)
+#define DELAY_STEPS 300 // PLANT_L / SIM_DT
+
+#define SHAPE_TOL 0.03f // 振幅、周期与极限环解析解的相对误差
+#define BIAS_MAX 0.4f   // Ku、Tu相对临界值的最大偏差
+
+Param_TypeDef Param;
+
+// ================= 对象 =================
+static float Plant_Y;
+static float Plant_U;
+static float Plant_Hist[DELAY_STEPS];
+static int Plant_Pos;
+
+static void plant_reset(float y0, float u0)
+{
+    int i;
+
+    Plant_Y = y0;
+    Plant_U = u0;
+    for (i = 0; i < DELAY_STEPS; i++)
+        Plant_Hist[i] = u0;
+    Plant_Pos = 0;
+}
+
+// 推进一个积分步长
+static void plant_step(void)
+{
+    float u_late = Plant_Hist[Plant_Pos];
+
+    Plant_Hist[Plant_Pos] = Plant_U;
+    Plant_Pos = (Plant_Pos + 1) % DELAY_STEPS;
+    Plant_Y += (PLANT_K * u_late - Plant_Y) * SIM_DT / PLANT_T;
+}
+
+// ================= 桩函数 (AutoTune_Run用，两轮共用同一对象) =================
+static uint32_t Now_Ms;
+static uint8_t Stopped, Saved;
+
+uint32_t millis(void)
+{
+    int i;
+
+    // 每读一次时钟推进1ms
+    for (i = 0; i < 10; i++)
+        plant_step();
+    return ++Now_Ms;
+}
+
+void Motor_SetDuty(float left_duty, float right_duty)
+{
+    (void)right_duty;
+    Plant_U = left_duty;
+}
+float Motor_GetLeftSpeed(void) { return Plant_Y; }
+float Motor_GetRightSpeed(void) { return Plant_Y; }
+void Motor_Stop(void) { Stopped = 1; }
+void Motor_SetGains(float kp, float ki, float kd)
+{
+    (void)kp;
+    (void)ki;
+    (void)kd;
+}
+uint8_t Param_Save(void)
+{
+    Saved = 1;
+    return 1;
+}
+
+// ================= 解析值 =================
+
+// FOPDT在带滞环继电器下的对称极限环：越过+eps后经过滞后L输入才翻转，
+// 振幅 a = Kd - (Kd - eps)e^(-L/T)，半周期 = L + T*ln((Kd + a)/(Kd - eps))
+static void limit_cycle(float l, float *a, float *tu)
+{
+    float kd = PLANT_K * AUTOTUNE_AMP, eps = AUTOTUNE_HYST;
+
+    *a = kd - (kd - eps) * expf(-l / PLANT_T);
+    *tu = 2.0f * (l + PLANT_T * logf((kd + *a) / (kd - eps)));
+}
+
+// 临界频率：atan(wT) + wL = pi，临界增益 Ku = sqrt(1 + (wT)^2) / K
+static void ultimate(float l, float *ku, float *tu)
+{
+    float lo = 0, hi = 3.1416f / l, w = 0;
+    int i;
+
+    for (i = 0; i < 60; i++)
+    {
+        w = (lo + hi) / 2;
+        if (atanf(w * PLANT_T) + w * l < 3.1416f)
+            lo = w;
+        else
+            hi = w;
+    }
+    *ku = sqrtf(1.0f + w * PLANT_T * w * PLANT_T) / PLANT_K;
+    *tu = 2.0f * 3.1416f / w;
+}
+
+// ================= 测试 =================
+
+static void test_relay(void)
+{
+    AutoTune_Relay relay;
+    float dt = MOTOR_PID_DIV / 1000.0f, l_eff = PLANT_L + dt / 2;
+    float a, tu, ku, a_lc, tu_lc, ku_lc, ku_u, tu_u;
+    float kp, ki, kd;
+    uint32_t n;
+    int i;
+
+    AutoTune_RelayInit(&relay);
+    plant_reset(0, AUTOTUNE_BIAS + AUTOTUNE_AMP);
+    for (n = 1; n < 2000 && !AutoTune_RelayDone(&relay); n++)
+    {
+        for (i = 0; i < MOTOR_PID_DIV * 10; i++)
+            plant_step();
+        Plant_U = AutoTune_RelayStep(&relay, Plant_Y, n);
+    }
+    CHECK(AutoTune_RelayDone(&relay));
+    CHECK(relay.Count == AUTOTUNE_CYCLES);
+
+    a = relay.SumAmp / relay.Count;
+    tu = relay.SumPeriod / relay.Count * dt;
+    ku = 4.0f * AUTOTUNE_AMP / (3.1416f * sqrtf(a * a - AUTOTUNE_HYST * AUTOTUNE_HYST));
+    limit_cycle(l_eff, &a_lc, &tu_lc);
+    ku_lc = 4.0f * AUTOTUNE_AMP / (3.1416f * sqrtf(a_lc * a_lc - AUTOTUNE_HYST * AUTOTUNE_HYST));
+    ultimate(l_eff, &ku_u, &tu_u);
+    printf("relay: a %.2f (limit cycle %.2f), Tu %.3f s (limit cycle %.3f, ultimate %.3f), "
+           "Ku %.3f (limit cycle %.3f, ultimate %.3f)\n",
+           a, a_lc, tu, tu_lc, tu_u, ku, ku_lc, ku_u);
+
+    CHECK_NEAR(a, a_lc, SHAPE_TOL * a_lc);
+    CHECK_NEAR(tu, tu_lc, SHAPE_TOL * tu_lc + dt);
+    CHECK_NEAR(ku, ku_lc, SHAPE_TOL * ku_lc);
+    // 偏保守且偏差有界
+    CHECK(ku < ku_u && ku > (1.0f - BIAS_MAX) * ku_u);
+    CHECK(tu > tu_u && tu < (1.0f + BIAS_MAX) * tu_u);
+
+    // Tyreus-Luyben，离散化到采样周期
+    CHECK(AutoTune_Gains(&relay, dt, &kp, &ki, &kd));
+    CHECK_NEAR(kp, ku / 2.2f, 1e-4);
+    CHECK_NEAR(ki, kp * dt / (2.2f * tu), 1e-5);
+    CHECK_NEAR(kd, kp * tu / 6.3f / dt, 1e-3);
+}
+
+static void test_no_oscillation(void)
+{
+    AutoTune_Relay relay;
+    float kp = 0, ki = 0, kd = 0;
+    uint32_t n;
+
+    // 速度一直在设定值以下：继电器不翻转，不产生周期
+    AutoTune_RelayInit(&relay);
+    for (n = 1; n < 500; n++)
+        CHECK(AutoTune_RelayStep(&relay, 10.0f, n) == AUTOTUNE_BIAS + AUTOTUNE_AMP);
+    CHECK(!AutoTune_RelayDone(&relay));
+    CHECK(!AutoTune_Gains(&relay, 0.01f, &kp, &ki, &kd));
+}
+
+static void test_match(void)
+{
+    CHECK(AutoTune_Match(1.0f, 1.0f));
+    CHECK(AutoTune_Match(0, 0));
+    CHECK(AutoTune_Match(1.0f, 1.2f));
+    CHECK(AutoTune_Match(PARAM_GAIN_MAX, PARAM_GAIN_MAX));
+    CHECK(!AutoTune_Match(1.0f, 1.5f));
+    CHECK(!AutoTune_Match(1.5f, 1.0f));
+    CHECK(!AutoTune_Match(PARAM_GAIN_MAX + 1, PARAM_GAIN_MAX + 1));
+    CHECK(!AutoTune_Match(-0.1f, 0));
+    CHECK(!AutoTune_Match(NAN, 1.0f));
+    CHECK(!AutoTune_Match(INFINITY, INFINITY));
+}
+
+static void test_run(void)
+{
+    float dt = MOTOR_PID_DIV / 1000.0f, a, tu, ku;
+
+    plant_reset(0, 0);
+    Now_Ms = 0;
+    Stopped = Saved = 0;
+    CHECK(AutoTune_Run());
+    CHECK(Stopped && Saved);
+    CHECK(Now_Ms < AUTOTUNE_TIMEOUT);
+
+    // 由写入的参数反推Ku、Tu，与解析极限环换算的值比较
+    limit_cycle(PLANT_L + dt / 2, &a, &tu);
+    ku = 4.0f * AUTOTUNE_AMP / (3.1416f * sqrtf(a * a - AUTOTUNE_HYST * AUTOTUNE_HYST));
+    CHECK_NEAR(Param.MotorKp * 2.2f, ku, SHAPE_TOL * ku);
+    CHECK_NEAR(Param.MotorKp * dt / Param.MotorKi / 2.2f, tu, SHAPE_TOL * tu + dt);
+    CHECK_NEAR(Param.MotorKd / Param.MotorKp * 6.3f * dt, tu, SHAPE_TOL * tu + dt);
+}
+
+int main(void)
+{
+    test_relay();
+    test_no_oscillation();
+    test_match();
+    test_run();
+    return TEST_DONE();
+}
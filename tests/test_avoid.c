@@ -0,0 +1,128 @@
+#include "test.h"
+#include "IRSensor.h"
+#include "Avoid.c" // 直接包含，以便比对static的动作程序
+
+/*
+ * 避障决策表 (user-003)：16个RED1/RED2/RED5/RED6组合逐一与原main.c的if/else链比对，
+ * 并检查RED3/RED4不影响选择、各动作程序与原来的调用顺序一致。
+ */
+
+enum
+{
+    SCENE_1 = 1, // RED1+RED2, RED5/6均未触
+    SCENE_2,     // RED1+RED2+RED6
+    SCENE_3,     // RED1+RED2+RED5
+    SCENE_4,     // RED1单触
+    SCENE_5,     // RED2单触
+    SCENE_FALLBACK
+};
+
+// 原main.c中的场景判断 (逐条照抄)
+static int baseline_scene(uint8_t r1, uint8_t r2, uint8_t r5, uint8_t r6)
+{
+    if (r1 == IR_HAVE_OBSTACLE && r2 == IR_HAVE_OBSTACLE &&
+        r5 == IR_NO_OBSTACLE && r6 == IR_NO_OBSTACLE)
+        return SCENE_1;
+    else if (r1 == IR_HAVE_OBSTACLE && r2 == IR_HAVE_OBSTACLE &&
+             r5 == IR_NO_OBSTACLE && r6 == IR_HAVE_OBSTACLE)
+        return SCENE_2;
+    else if (r1 == IR_HAVE_OBSTACLE && r2 == IR_HAVE_OBSTACLE &&
+             r5 == IR_HAVE_OBSTACLE && r6 == IR_NO_OBSTACLE)
+        return SCENE_3;
+    else if (r1 == IR_HAVE_OBSTACLE && r2 == IR_NO_OBSTACLE &&
+             r5 == IR_NO_OBSTACLE && r6 == IR_NO_OBSTACLE)
+        return SCENE_4;
+    else if (r1 == IR_NO_OBSTACLE && r2 == IR_HAVE_OBSTACLE &&
+             r5 == IR_NO_OBSTACLE && r6 == IR_NO_OBSTACLE)
+        return SCENE_5;
+    return SCENE_FALLBACK;
+}
+
+// 各场景原来执行的动作 (停车1s之后)
+static const Maneuver_Step *scene_program(int scene)
+{
+    switch (scene)
+    {
+    case SCENE_3: return Avoid_UTurnRight;
+    case SCENE_4: return Avoid_BypassRight;
+    case SCENE_5: return Avoid_BypassLeft;
+    default: return Avoid_UTurnLeft; // 场景1/2和兜底的动作相同
+    }
+}
+
+// 比对动作程序 (含MV_END)
+static int same_program(const Maneuver_Step *a, const Maneuver_Step *b)
+{
+    while (a->Op == b->Op && a->Arg == b->Arg)
+    {
+        if (a->Op == MV_END)
+            return 1;
+        a++;
+        b++;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    uint8_t key, other, mask;
+    uint8_t r1, r2, r5, r6;
+
+    // 键值位0~3为RED1/RED2/RED5/RED6：只有RED1右绕行，只有RED2左绕行，RED1+RED2+RED5右掉头，其余左掉头
+    for (key = 0; key < 16; key++)
+    {
+        const Maneuver_Step *expect = Avoid_UTurnLeft;
+        if (key == 7)
+            expect = Avoid_UTurnRight;
+        else if (key == 1)
+            expect = Avoid_BypassRight;
+        else if (key == 2)
+            expect = Avoid_BypassLeft;
+        CHECK(Avoid_Table[key] == expect);
+    }
+
+    // 与原if/else链逐一比对，RED3/RED4任意取值
+    for (key = 0; key < 16; key++)
+    {
+        r1 = (key & 1) ? IR_HAVE_OBSTACLE : IR_NO_OBSTACLE;
+        r2 = (key & 2) ? IR_HAVE_OBSTACLE : IR_NO_OBSTACLE;
+        r5 = (key & 4) ? IR_HAVE_OBSTACLE : IR_NO_OBSTACLE;
+        r6 = (key & 8) ? IR_HAVE_OBSTACLE : IR_NO_OBSTACLE;
+        for (other = 0; other < 4; other++)
+        {
+            mask = (uint8_t)(((key & 1) ? IR_MASK_RED1 : 0) | ((key & 2) ? IR_MASK_RED2 : 0) |
+                             ((key & 4) ? IR_MASK_RED5 : 0) | ((key & 8) ? IR_MASK_RED6 : 0) |
+                             ((other & 1) ? IR_MASK_RED3 : 0) | ((other & 2) ? IR_MASK_RED4 : 0));
+            CHECK(AVOID_KEY(mask) == key);
+            CHECK(Avoid_Select(mask) == scene_program(baseline_scene(r1, r2, r5, r6)));
+        }
+    }
+
+    // 动作程序与原来的调用顺序一致 (MV_STOP 100 即原来的停车1s)
+    {
+        static const Maneuver_Step uturn_left[] = {
+            {MV_STOP, 100}, {MV_WAIT, 20}, {MV_BACK, 10}, {MV_TURN_LEFT, 0},
+            {MV_FORWARD, 5}, {MV_TURN_LEFT, 0}, {MV_RESUME, 0}, {MV_END, 0}};
+        static const Maneuver_Step uturn_right[] = {
+            {MV_STOP, 100}, {MV_WAIT, 20}, {MV_BACK, 10}, {MV_TURN_RIGHT, 0},
+            {MV_FORWARD, 5}, {MV_TURN_RIGHT, 0}, {MV_RESUME, 0}, {MV_END, 0}};
+        static const Maneuver_Step bypass_right[] = {
+            {MV_STOP, 100}, {MV_BACK, 10}, {MV_TURN_RIGHT, 0}, {MV_FORWARD, 5},
+            {MV_TURN_LEFT, 0}, {MV_FORWARD, 5}, {MV_TURN_LEFT, 0}, {MV_FORWARD, 5},
+            {MV_TURN_RIGHT, 0}, {MV_RESUME, 0}, {MV_END, 0}};
+        static const Maneuver_Step bypass_left[] = {
+            {MV_STOP, 100}, {MV_BACK, 10}, {MV_TURN_LEFT, 0}, {MV_FORWARD, 5},
+            {MV_TURN_RIGHT, 0}, {MV_FORWARD, 5}, {MV_TURN_RIGHT, 0}, {MV_FORWARD, 5},
+            {MV_TURN_LEFT, 0}, {MV_RESUME, 0}, {MV_END, 0}};
+        static const Maneuver_Step timeout[] = {
+            {MV_BACK, 10}, {MV_TURN_RIGHT, 0}, {MV_RESUME, 0}, {MV_END, 0}};
+
+        CHECK(same_program(Avoid_UTurnLeft, uturn_left));
+        CHECK(same_program(Avoid_UTurnRight, uturn_right));
+        CHECK(same_program(Avoid_BypassRight, bypass_right));
+        CHECK(same_program(Avoid_BypassLeft, bypass_left));
+        CHECK(same_program(Avoid_Timeout, timeout));
+    }
+
+    return TEST_DONE();
+}
@@ -0,0 +1,191 @@
+#include "test.h"
+#include "Maneuver.h"
+#include "motor.h"
+#include "delay.h"
+#include "Param.h"
+
+/*
+ * 非阻塞动作执行器 (user-004)：电机接口换成记录调用的桩函数，按模拟的节拍推进，检查
+ * - 定时步骤到期后多余的时间顺延给下一步 (一次大步长可跨过多个步骤)
+ * - 移动类步骤由完成条件结束，结束时停车，再开始下一步
+ * - 开始动作和转向结束时清空测距滤波器
+ * - 中止、空程序、当前动作查询和阻塞版Maneuver_Run
+ */
+
+Param_TypeDef Param;
+
+// ================= 桩函数 =================
+static int Stops, Moves, Turns, Resumes, Resets;
+static float Last_Cm, Last_Deg;
+static uint8_t Move_Done, Turn_Done;
+static uint32_t Now_Ms;
+
+void Motor_Stop(void) { Stops++; }
+void Motor_ResumeNormal(void) { Resumes++; }
+void Motor_MoveStart(float cm, float left_speed, float right_speed)
+{
+    (void)left_speed;
+    (void)right_speed;
+    Moves++;
+    Last_Cm = cm;
+    Move_Done = 0;
+}
+uint8_t Motor_MoveDone(void) { return Move_Done; }
+void Motor_TurnStart(float deg)
+{
+    Turns++;
+    Last_Deg = deg;
+    Turn_Done = 0;
+}
+uint8_t Motor_TurnDone(void) { return Turn_Done; }
+void Ranging_Reset(void) { Resets++; }
+
+// Maneuver_Run用：每读一次时钟过去1ms，到第50ms时移动完成
+uint32_t millis(void)
+{
+    Now_Ms++;
+    if (Now_Ms == 50)
+        Move_Done = 1;
+    return Now_Ms;
+}
+
+static void reset_stubs(void)
+{
+    Stops = Moves = Turns = Resumes = Resets = 0;
+    Move_Done = Turn_Done = 0;
+}
+
+// ================= 测试 =================
+static const Maneuver_Step Timed[] = {
+    {MV_STOP, 10}, // 100ms
+    {MV_WAIT, 5},  // 50ms
+    {MV_FORWARD, 7},
+    {MV_TURN_RIGHT, 0},
+    {MV_RESUME, 0},
+    {MV_END, 0}};
+
+static void test_carry(void)
+{
+    reset_stubs();
+    Maneuver_Start(Timed);
+    CHECK(Maneuver_IsBusy());
+    CHECK(Maneuver_CurrentOp() == MV_STOP);
+    CHECK(Stops == 1);
+    CHECK(Resets == 1);
+
+    Maneuver_Tick(30);
+    Maneuver_Tick(30);
+    Maneuver_Tick(30);
+    CHECK(Maneuver_CurrentOp() == MV_STOP); // 90ms
+
+    Maneuver_Tick(30); // 120ms：停车结束，20ms顺延给等待
+    CHECK(Maneuver_CurrentOp() == MV_WAIT);
+    Maneuver_Tick(29); // 等待已过49ms
+    CHECK(Maneuver_CurrentOp() == MV_WAIT);
+    CHECK(Moves == 0);
+    Maneuver_Tick(1);  // 正好50ms
+    CHECK(Maneuver_CurrentOp() == MV_FORWARD);
+    CHECK(Moves == 1);
+    CHECK(Last_Cm == 7.0f);
+
+    // 移动类步骤不按时间结束
+    Maneuver_Tick(1000);
+    CHECK(Maneuver_CurrentOp() == MV_FORWARD);
+
+    Move_Done = 1;
+    Maneuver_Tick(10); // 前进结束停车，开始右转
+    CHECK(Stops == 2);
+    CHECK(Maneuver_CurrentOp() == MV_TURN_RIGHT);
+    CHECK(Turns == 1);
+    CHECK(Last_Deg == -90.0f);
+    CHECK(Resets == 1); // 前进结束不清空
+
+    Turn_Done = 1;
+    Maneuver_Tick(10); // 右转结束停车，恢复直行，程序结束
+    CHECK(Stops == 3);
+    CHECK(Resets == 2);
+    CHECK(Resumes == 1);
+    CHECK(!Maneuver_IsBusy());
+    CHECK(Maneuver_CurrentOp() == MV_END);
+}
+
+static void test_big_step(void)
+{
+    // 一次160ms跨过停车(100)和等待(50)，直接开始前进
+    reset_stubs();
+    Maneuver_Start(Timed);
+    Maneuver_Tick(160);
+    CHECK(Maneuver_CurrentOp() == MV_FORWARD);
+    CHECK(Moves == 1);
+    Maneuver_Abort();
+}
+
+static void test_abort(void)
+{
+    static const Maneuver_Step empty[] = {{MV_END, 0}};
+
+    reset_stubs();
+    Maneuver_Start(Timed);
+    Maneuver_Tick(200);
+    CHECK(Maneuver_CurrentOp() == MV_FORWARD);
+    Maneuver_Abort();
+    CHECK(!Maneuver_IsBusy());
+    CHECK(Stops == 2); // 程序开头一次 + 中止一次
+
+    // 中止后推进不再有动作
+    Move_Done = 1;
+    Maneuver_Tick(100);
+    CHECK(Turns == 0);
+
+    // 空闲时中止不重复停车
+    Maneuver_Abort();
+    CHECK(Stops == 2);
+
+    // 空程序
+    Maneuver_Start(empty);
+    CHECK(!Maneuver_IsBusy());
+
+    // 执行中重新装入程序从头开始
+    Maneuver_Start(Timed);
+    Maneuver_Tick(120);
+    Maneuver_Start(Timed);
+    CHECK(Maneuver_CurrentOp() == MV_STOP);
+    Maneuver_Tick(99);
+    CHECK(Maneuver_CurrentOp() == MV_STOP);
+    Maneuver_Abort();
+}
+
+static void test_zero_length(void)
+{
+    // 零时长步骤在Start中立即完成
+    static const Maneuver_Step resume_only[] = {{MV_WAIT, 0}, {MV_RESUME, 0}, {MV_END, 0}};
+
+    reset_stubs();
+    Maneuver_Start(resume_only);
+    CHECK(Resumes == 1);
+    CHECK(!Maneuver_IsBusy());
+}
+
+static void test_run(void)
+{
+    static const Maneuver_Step back[] = {{MV_BACK, 10}, {MV_END, 0}};
+
+    reset_stubs();
+    Now_Ms = 0;
+    Maneuver_Run(back);
+    CHECK(Moves == 1);
+    CHECK(Last_Cm == -10.0f);
+    CHECK(Stops == 1);
+    CHECK(Now_Ms >= 50);
+    CHECK(!Maneuver_IsBusy());
+}
+
+int main(void)
+{
+    test_carry();
+    test_big_step();
+    test_abort();
+    test_zero_length();
+    test_run();
+    return TEST_DONE();
+}
@@ -0,0 +1,320 @@
+#include "test.h"
+#include "PID.h"
+#include "motor.h"
+
+/*
+ * 浮点PID与Q16.16定点PID (user-010)：用电机速度环的参数和范围 (±100%)，
+ * 相同输入序列分别送入PID_Calc和PIDQ_Calc，检查两者输出的最大偏差。
+ * - 开环：随机目标阶跃 + 随机实测值，覆盖饱和、抗饱和反算和微分滤波
+ * - 闭环：各自驱动一份一阶惯性对象，轨迹偏差不累积
+ * 容差：输出单位为占空比%，允许偏差PID_EQ_TOL (0.05%)，为PWM分辨率 (1%) 的1/20。
+ * 定点乘法右移向下取整，增量式开环时截断误差在输出 (即积分状态) 中累积，偏差最大；
+ * 闭环时反馈把它拉回，偏差小一个数量级以上。
+ *
+ * 阶跃响应 (user-011)：浮点PID驱动一阶惯性对象，检查
+ * - 电机参数下的超调、调节时间和稳态误差
+ * - 输出饱和后回到可达目标的恢复时间：反算抗饱和 (Kaw) 比不反算快
+ * - 微分低通 (DFilter) 的响应序列，以及对测量噪声的抑制
+ * - 增量式无稳态误差，前馈 (Kf) 在阶跃当拍给出输出、加快上升
+ */
+
+#define PID_EQ_TOL 0.05f
+#define STEPS 200000
+
+static uint32_t Rng = 12345;
+static uint32_t next(void)
+{
+    Rng ^= Rng << 13;
+    Rng ^= Rng >> 17;
+    Rng ^= Rng << 5;
+    return Rng;
+}
+
+// [-a, a) 内的随机数，量化到Q16.16可精确表示的值，避免把输入量化误差算进算法偏差
+static float rnd(float a)
+{
+    float x = ((next() & 0xFFFF) / 32768.0f - 1.0f) * a;
+    return Q16_TO_FLOAT(Q16(x));
+}
+
+static void config_pair(PID_TypeDef *f, PIDQ_TypeDef *q, uint8_t mode,
+                        float kp, float ki, float kd, float kf, float kaw, float dfilter)
+{
+    PID_Config(f, mode, kp, ki, kd, -100.0f, 100.0f);
+    f->Kf = kf;
+    f->Kaw = kaw;
+    f->DFilter = dfilter;
+    PIDQ_Config(q, mode, Q16(kp), Q16(ki), Q16(kd), Q16(-100.0f), Q16(100.0f));
+    q->Kf = Q16(kf);
+    q->Kaw = Q16(kaw);
+    q->DFilter = Q16(dfilter);
+    // 浮点增益取定点能表示的值，只比较运算本身
+    f->Kp = Q16_TO_FLOAT(q->Kp);
+    f->Ki = Q16_TO_FLOAT(q->Ki);
+    f->Kd = Q16_TO_FLOAT(q->Kd);
+    f->Kf = Q16_TO_FLOAT(q->Kf);
+    f->Kaw = Q16_TO_FLOAT(q->Kaw);
+    f->DFilter = Q16_TO_FLOAT(q->DFilter);
+}
+
+static float open_loop(uint8_t mode)
+{
+    PID_TypeDef f;
+    PIDQ_TypeDef q;
+    float target = 0, actual, err, max_err = 0;
+    int i;
+
+    config_pair(&f, &q, mode, MOTOR_KP, MOTOR_KI, MOTOR_KD, MOTOR_KF, MOTOR_KAW, MOTOR_D_FILTER);
+    for (i = 0; i < STEPS; i++)
+    {
+        if (next() % 50 == 0)
+            target = rnd(100.0f);
+        actual = target + rnd(30.0f);
+        err = fabsf(PID_Calc(&f, target, actual) - Q16_TO_FLOAT(PIDQ_Calc(&q, Q16(target), Q16(actual))));
+        if (err > max_err)
+            max_err = err;
+    }
+    return max_err;
+}
+
+// 一阶惯性对象：速度% 跟随占空比%，时间常数5个周期
+static float plant(float y, float u)
+{
+    return y + (u - y) * 0.2f;
+}
+
+static float closed_loop(uint8_t mode)
+{
+    PID_TypeDef f;
+    PIDQ_TypeDef q;
+    float target = 0, yf = 0, yq = 0, err, max_err = 0;
+    int i;
+
+    config_pair(&f, &q, mode, MOTOR_KP, MOTOR_KI, MOTOR_KD, MOTOR_KF, MOTOR_KAW, MOTOR_D_FILTER);
+    for (i = 0; i < STEPS; i++)
+    {
+        if (i % 200 == 0)
+            target = rnd(100.0f);
+        // 实测值按编码器分辨率量化，两边独立取整
+        yf = plant(yf, PID_Calc(&f, target, Q16_TO_FLOAT(Q16(yf))));
+        yq = plant(yq, Q16_TO_FLOAT(PIDQ_Calc(&q, Q16(target), Q16(yq))));
+        err = fabsf(yf - yq);
+        if (err > max_err)
+            max_err = err;
+    }
+    return max_err;
+}
+
+// ================= 阶跃响应 =================
+
+#define SETTLE_BAND 0.02f // 调节带：目标的±2%
+
+typedef struct
+{
+    float Overshoot; // 超调 (目标的百分比)
+    int Rise;        // 首次到达目标90%的步数
+    int Settle;      // 最后一次进入调节带的步数
+    float Final;     // 结束时的输出
+} Step_Result;
+
+// 对象增益gain，从y0阶跃到target，运行steps步
+static Step_Result step_response(PID_TypeDef *pid, float gain, float y0, float target, int steps)
+{
+    Step_Result r = {0, -1, 0, 0};
+    float y = y0, peak = y0;
+    float span = target - y0;
+    int i;
+
+    for (i = 0; i < steps; i++)
+    {
+        y = plant(y, gain * PID_Calc(pid, target, y));
+        if ((y - peak) * span > 0)
+            peak = y;
+        if (r.Rise < 0 && (y - y0) / span >= 0.9f)
+            r.Rise = i + 1;
+        if (fabsf(y - target) > SETTLE_BAND * fabsf(span))
+            r.Settle = i + 1;
+    }
+    r.Overshoot = (peak - target) / span * 100.0f;
+    if (r.Overshoot < 0)
+        r.Overshoot = 0;
+    r.Final = y;
+    return r;
+}
+
+static void motor_pid(PID_TypeDef *pid, uint8_t mode)
+{
+    PID_Config(pid, mode, MOTOR_KP, MOTOR_KI, MOTOR_KD, -100.0f, 100.0f);
+    pid->Kf = MOTOR_KF;
+    pid->Kaw = MOTOR_KAW;
+    pid->DFilter = MOTOR_D_FILTER;
+}
+
+static void test_step(void)
+{
+    PID_TypeDef pid;
+    Step_Result r;
+
+    // 电机参数，0 -> 50%
+    motor_pid(&pid, PID_POSITIONAL);
+    r = step_response(&pid, 1.0f, 0, 50.0f, 300);
+    printf("step: overshoot %.2f%% rise %d settle %d final %.3f\n", r.Overshoot, r.Rise, r.Settle, r.Final);
+    CHECK(r.Overshoot < 5.0f);
+    CHECK(r.Rise > 0 && r.Rise <= 10);
+    CHECK(r.Settle <= 30);
+    CHECK_NEAR(r.Final, 50.0f, 0.05f);
+
+    // 对象增益偏低 (实际满速比标定的慢20%)，前馈不准时靠积分消除稳态误差
+    motor_pid(&pid, PID_POSITIONAL);
+    r = step_response(&pid, 0.8f, 0, 50.0f, 300);
+    CHECK(r.Overshoot < 5.0f);
+    CHECK(r.Settle <= 60);
+    CHECK_NEAR(r.Final, 50.0f, 0.05f);
+}
+
+// 对象增益0.5时，目标80需要160%的输出，饱和运行后改为可达的30，返回恢复到调节带的步数
+static int saturation_recovery(float kaw, float *integral_at_switch)
+{
+    PID_TypeDef pid;
+    Step_Result r;
+    float y = 0;
+    int i;
+
+    PID_Config(&pid, PID_POSITIONAL, 1.0f, 0.2f, 0, -100.0f, 100.0f);
+    pid.Kaw = kaw;
+    for (i = 0; i < 200; i++)
+        y = plant(y, 0.5f * PID_Calc(&pid, 80.0f, y));
+    *integral_at_switch = pid.Integral;
+    r = step_response(&pid, 0.5f, y, 30.0f, 300);
+    return r.Settle;
+}
+
+static void test_anti_windup(void)
+{
+    float i_aw, i_no;
+    int t_aw, t_no;
+
+    t_no = saturation_recovery(0, &i_no);
+    t_aw = saturation_recovery(MOTOR_KAW, &i_aw);
+    printf("saturation recovery: Kaw 0 %d steps (I %.1f), Kaw %.1f %d steps (I %.1f)\n",
+           t_no, i_no, MOTOR_KAW, t_aw, i_aw);
+    // 不反算时积分一直累积到限幅；反算时积分停在Ki*e与回拉量平衡处：
+    // 饱和稳态y=50，e=30，Ki*e = Kaw*(Kp*e + I - 100) => I = 100 - Kp*e + Ki*e/Kaw
+    CHECK_NEAR(i_no, 100.0f, 0.01f);
+    CHECK_NEAR(i_aw, 100.0f - 30.0f + 0.2f * 30.0f / MOTOR_KAW, 0.1f);
+    CHECK(t_aw < t_no);
+    CHECK(t_aw <= 40);
+}
+
+static void test_d_filter(void)
+{
+    PID_TypeDef pid;
+    float d, expect, var_raw = 0, var_filt = 0, last;
+    int i;
+
+    // 只有微分项：误差从0阶跃到10，原始微分为Kd*10，之后为0
+    PID_Config(&pid, PID_POSITIONAL, 0, 0, 1.0f, -100.0f, 100.0f);
+    CHECK_NEAR(PID_Calc(&pid, 10.0f, 0), 10.0f, 1e-5); // 不滤波：当拍全部输出
+    CHECK_NEAR(PID_Calc(&pid, 10.0f, 0), 0, 1e-5);
+
+    PID_Config(&pid, PID_POSITIONAL, 0, 0, 1.0f, -100.0f, 100.0f);
+    pid.DFilter = 0.3f;
+    expect = 0;
+    for (i = 0; i < 10; i++)
+    {
+        d = PID_Calc(&pid, 10.0f, 0);
+        // D += 0.3*(D原始 - D)：第一拍3，之后每拍乘0.7
+        expect = i == 0 ? 3.0f : expect * 0.7f;
+        CHECK_NEAR(d, expect, 1e-4);
+    }
+
+    // 测量噪声±1：滤波后微分项的方差小于不滤波
+    for (i = 0; i < 2; i++)
+    {
+        float *var = i ? &var_filt : &var_raw;
+        int k;
+
+        PID_Config(&pid, PID_POSITIONAL, 0, 0, 1.0f, -100.0f, 100.0f);
+        pid.DFilter = i ? 0.3f : 1.0f;
+        Rng = 999;
+        last = 0;
+        for (k = 0; k < 10000; k++)
+        {
+            last = PID_Calc(&pid, 0, rnd(1.0f));
+            *var += last * last;
+        }
+    }
+    printf("d noise power: DFilter 1 %.1f, DFilter 0.3 %.1f\n", var_raw, var_filt);
+    CHECK(var_filt < 0.3f * var_raw);
+}
+
+static void test_incremental(void)
+{
+    PID_TypeDef pid, pos;
+    Step_Result r, rp;
+    float out;
+
+    // 增量式：输出本身就是积分状态，阶跃后无稳态误差
+    PID_Config(&pid, PID_INCREMENTAL, 0.5f, 0.2f, 0, -100.0f, 100.0f);
+    r = step_response(&pid, 0.8f, 0, 50.0f, 300);
+    printf("incremental: overshoot %.2f%% settle %d final %.3f\n", r.Overshoot, r.Settle, r.Final);
+    CHECK_NEAR(r.Final, 50.0f, 0.05f);
+    CHECK(r.Overshoot < 10.0f);
+    CHECK(r.Settle <= 60);
+    // 稳态输出 = 目标 / 对象增益
+    CHECK_NEAR(pid.Output, 50.0f / 0.8f, 0.1f);
+
+    // 输出限幅即抗饱和：目标不可达时输出停在上限，改为可达目标后立即开始回落
+    PID_Config(&pid, PID_INCREMENTAL, 0.5f, 0.2f, 0, -100.0f, 100.0f);
+    r = step_response(&pid, 0.5f, 0, 80.0f, 200);
+    CHECK_NEAR(pid.Output, 100.0f, 1e-4);
+    r = step_response(&pid, 0.5f, r.Final, 30.0f, 300);
+    CHECK(r.Settle <= 40);
+    CHECK_NEAR(r.Final, 30.0f, 0.05f);
+
+    // 前馈：只有Kf时，两种模式在阶跃当拍都输出Kf*目标
+    PID_Config(&pid, PID_INCREMENTAL, 0, 0, 0, -100.0f, 100.0f);
+    pid.Kf = 1.0f;
+    PID_Config(&pos, PID_POSITIONAL, 0, 0, 0, -100.0f, 100.0f);
+    pos.Kf = 1.0f;
+    out = PID_Calc(&pid, 40.0f, 0);
+    CHECK_NEAR(out, 40.0f, 1e-5);
+    CHECK_NEAR(PID_Calc(&pos, 40.0f, 0), 40.0f, 1e-5);
+    // 增量式按目标变化量叠加前馈：目标不变时不再增加
+    CHECK_NEAR(PID_Calc(&pid, 40.0f, 0), 40.0f, 1e-5);
+    CHECK_NEAR(PID_Calc(&pid, 25.0f, 0), 25.0f, 1e-5);
+
+    // 前馈加快上升：同样的PI参数，加Kf=1后到达90%的步数更少
+    PID_Config(&pos, PID_POSITIONAL, 0.5f, 0.05f, 0, -100.0f, 100.0f);
+    rp = step_response(&pos, 1.0f, 0, 50.0f, 300);
+    PID_Config(&pos, PID_POSITIONAL, 0.5f, 0.05f, 0, -100.0f, 100.0f);
+    pos.Kf = 1.0f;
+    r = step_response(&pos, 1.0f, 0, 50.0f, 300);
+    printf("feed-forward: rise %d -> %d\n", rp.Rise, r.Rise);
+    CHECK(r.Rise < rp.Rise);
+    CHECK_NEAR(r.Final, 50.0f, 0.05f);
+}
+
+int main(void)
+{
+    float e;
+
+    e = open_loop(PID_POSITIONAL);
+    printf("positional open loop: max %.6f\n", e);
+    CHECK(e <= PID_EQ_TOL);
+    e = open_loop(PID_INCREMENTAL);
+    printf("incremental open loop: max %.6f\n", e);
+    CHECK(e <= PID_EQ_TOL);
+    e = closed_loop(PID_POSITIONAL);
+    printf("positional closed loop: max %.6f\n", e);
+    CHECK(e <= PID_EQ_TOL);
+    e = closed_loop(PID_INCREMENTAL);
+    printf("incremental closed loop: max %.6f\n", e);
+    CHECK(e <= PID_EQ_TOL);
+
+    test_step();
+    test_anti_windup();
+    test_d_filter();
+    test_incremental();
+    return TEST_DONE();
+}
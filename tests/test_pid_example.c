@@ -0,0 +1,3 @@
+// 例程工程中的PID副本 (example/PID_encoder_motor/Hardware，GBK编码)：运行与根目录PID相同的测试，防止两份分叉
+#include "../example/PID_encoder_motor/Hardware/PID.h"
+#include "test_pid.c"
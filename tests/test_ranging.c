@@ -0,0 +1,162 @@
+#include "test.h"
+#include "Ranging.h"
+#include "Ultrasound.h"
+
+/*
+ * 超声波测距滤波 (user-024)：只链接Ranging.c，按测量周期ULTRA_PERIOD输入测量值，检查
+ * - 稳定读数中的单次尖峰被中值剔除，距离和接近速度都不受影响
+ * - 超出量程 (999) 按RANGING_MAX_CM处理
+ * - 连续RANGING_MAX_MISS次无回波 (-1) 后输出无效，次数不够时保持上一次结果
+ * - 中值跳变超过RANGING_GATE_CM时滤波器重新初始化，不产生速度
+ * - 匀速接近：接近速度收敛到真实速度，输出距离按中值滞后RANGING_DELAY_S外推到最新测量，
+ *   Ranging_ShouldStop在距离进入 min + 接近速度*ttc 时触发；远离或静止时只按min判断
+ */
+
+#define T_S (ULTRA_PERIOD / 1000000.0f) // 测量周期 (s)
+
+static void feed(float raw, uint8_t n)
+{
+    while (n--)
+        Ranging_Update(raw, 1);
+}
+
+static void test_spike(void)
+{
+    Ranging_Reset();
+    feed(100.0f, RANGING_WINDOW);
+    CHECK_NEAR(Ranging_GetDistance(), 100.0f, 1e-4);
+
+    // 串扰造成的单次近距离回波
+    Ranging_Update(20.0f, 1);
+    CHECK_NEAR(Ranging_GetDistance(), 100.0f, 1e-4);
+    CHECK_NEAR(Ranging_GetClosing(), 0, 1e-4);
+    CHECK(!Ranging_ShouldStop(30.0f, 1.0f));
+
+    feed(100.0f, RANGING_WINDOW);
+    CHECK_NEAR(Ranging_GetDistance(), 100.0f, 1e-4);
+    CHECK_NEAR(Ranging_GetClosing(), 0, 1e-4);
+}
+
+static void test_clamp(void)
+{
+    Ranging_Reset();
+    CHECK(Ranging_GetDistance() == -1.0f);
+    Ranging_Update(999.0f, 1);
+    CHECK(Ranging_GetDistance() == RANGING_MAX_CM);
+    feed(999.0f, RANGING_WINDOW);
+    CHECK(Ranging_GetDistance() == RANGING_MAX_CM);
+    CHECK_NEAR(Ranging_GetClosing(), 0, 1e-4);
+}
+
+static void test_miss(void)
+{
+    uint8_t i;
+
+    Ranging_Reset();
+    feed(80.0f, RANGING_WINDOW);
+    for (i = 1; i < RANGING_MAX_MISS; i++)
+    {
+        Ranging_Update(-1.0f, 1);
+        CHECK_NEAR(Ranging_GetDistance(), 80.0f, 1e-4);
+    }
+    Ranging_Update(-1.0f, 1);
+    CHECK(Ranging_GetDistance() == -1.0f);
+    CHECK(!Ranging_ShouldStop(1000.0f, 1.0f));
+
+    // 中间有一次回波时重新计数
+    feed(80.0f, 1);
+    feed(-1.0f, RANGING_MAX_MISS - 1);
+    feed(80.0f, 1);
+    feed(-1.0f, RANGING_MAX_MISS - 1);
+    CHECK_NEAR(Ranging_GetDistance(), 80.0f, 1e-4);
+}
+
+static void test_gate(void)
+{
+    float far = 150.0f, near = far - RANGING_GATE_CM - 20.0f;
+    uint8_t i;
+
+    Ranging_Reset();
+    feed(far, RANGING_WINDOW);
+
+    // 转向后换了目标：中值在第 (WINDOW+1)/2 个新样本时跳变
+    for (i = 0; i < (RANGING_WINDOW + 1) / 2 - 1; i++)
+    {
+        Ranging_Update(near, 1);
+        CHECK_NEAR(Ranging_GetDistance(), far, 1e-4);
+    }
+    Ranging_Update(near, 1);
+    CHECK_NEAR(Ranging_GetDistance(), near, 1e-4);
+    CHECK_NEAR(Ranging_GetClosing(), 0, 1e-4);
+    feed(near, RANGING_WINDOW);
+    CHECK_NEAR(Ranging_GetDistance(), near, 1e-4);
+    CHECK_NEAR(Ranging_GetClosing(), 0, 1e-4);
+}
+
+static void test_approach(void)
+{
+    const float v = 50.0f, min = 10.0f, ttc = 0.3f;
+    float raw = 300.0f, prev = raw;
+    float trigger = min + v * ttc;
+    uint8_t stop = 0;
+    uint32_t k;
+
+    Ranging_Reset();
+    for (k = 0; k < 30; k++)
+    {
+        Ranging_Update(raw, 1);
+        raw -= v * T_S;
+    }
+    raw += v * T_S; // 最后一次输入的值
+    CHECK_NEAR(Ranging_GetClosing(), v, 0.5);
+    // 外推补偿中值的滞后，输出对齐最新测量 (不补偿时大 v*RANGING_DELAY_S = 6cm)
+    CHECK_NEAR(Ranging_GetDistance(), raw, 0.3);
+    CHECK(!Ranging_ShouldStop(min, ttc));
+
+    // 漏掉一次测量 (序号差2)：窗口中的样本不再等间隔，速度短暂偏离后回到真实值，不会重新初始化
+    raw -= 2 * v * T_S;
+    Ranging_Update(raw, 2);
+    CHECK(Ranging_GetClosing() > v / 2);
+    for (k = 0; k < 10; k++)
+    {
+        raw -= v * T_S;
+        Ranging_Update(raw, 1);
+    }
+    CHECK_NEAR(Ranging_GetClosing(), v, 0.5);
+
+    // 继续接近，第一次触发时最新测量刚进入 min + v*ttc (误差不超过一个周期的行程)
+    while (raw > 0 && !stop)
+    {
+        prev = raw;
+        raw -= v * T_S;
+        Ranging_Update(raw, 1);
+        stop = Ranging_ShouldStop(min, ttc);
+    }
+    printf("approach: stop at %.1f cm (trigger %.1f cm)\n", raw, trigger);
+    CHECK(stop);
+    CHECK(raw <= trigger + 0.5f);
+    CHECK(prev > trigger - 0.5f);
+
+    // 远离：只按min判断
+    Ranging_Reset();
+    for (raw = 20.0f; raw < 60.0f; raw += v * T_S)
+        Ranging_Update(raw, 1);
+    CHECK(Ranging_GetClosing() < -v + 0.5f);
+    CHECK(!Ranging_ShouldStop(min, ttc));
+
+    // 静止：接近速度为0，距离不超过min时停车
+    Ranging_Reset();
+    feed(12.0f, RANGING_WINDOW);
+    CHECK(!Ranging_ShouldStop(min, ttc));
+    CHECK(Ranging_ShouldStop(12.0f, ttc));
+}
+
+int main(void)
+{
+    test_spike();
+    test_clamp();
+    test_miss();
+    test_gate();
+    test_approach();
+    return TEST_DONE();
+}
@@ -0,0 +1,165 @@
+#include "test.h"
+#include "Scheduler.h"
+
+/*
+ * 调度器 (user-006)：用虚拟时钟代替micros，任务函数按设定的执行时间推进时钟，检查
+ * - 按周期释放，无累积漂移，表中靠前的任务先执行
+ * - WCET取最长一次执行时间
+ * - 执行结束时已错过下一次释放计为超时，重新对齐到结束时刻，不补跑
+ * - 32位时钟回绕
+ */
+
+static uint32_t Now;
+static uint32_t Cost_A, Cost_B;
+static char Order[64];
+static uint8_t Order_Len;
+
+static uint32_t clock_us(void) { return Now; }
+
+static void task_a(void)
+{
+    if (Order_Len < sizeof(Order) - 1)
+        Order[Order_Len++] = 'A';
+    Now += Cost_A;
+}
+
+static void task_b(void)
+{
+    if (Order_Len < sizeof(Order) - 1)
+        Order[Order_Len++] = 'B';
+    Now += Cost_B;
+}
+
+static Scheduler_Task Tasks[2];
+
+static void setup(uint32_t start, uint32_t period_a, uint32_t period_b)
+{
+    Scheduler_Task a = SCHEDULER_TASK("a", task_a, 0);
+    Scheduler_Task b = SCHEDULER_TASK("b", task_b, 0);
+
+    a.Period = period_a;
+    b.Period = period_b;
+    Tasks[0] = a;
+    Tasks[1] = b;
+    Now = start;
+    Cost_A = Cost_B = 0;
+    Order_Len = 0;
+    Order[0] = 0;
+    Scheduler_Init(Tasks, 2, clock_us);
+}
+
+// 主循环：每轮调度后空闲时钟前进step，直到跑完duration
+static void run_for(uint32_t duration, uint32_t step)
+{
+    uint32_t end = Now + duration;
+    while ((int32_t)(Now - end) < 0)
+    {
+        Scheduler_Dispatch();
+        Now += step;
+    }
+    Order[Order_Len] = 0;
+}
+
+static void test_periods(void)
+{
+    setup(0, 1000, 2500);
+    run_for(10000, 100);
+    CHECK(Tasks[0].RunCount == 10); // 0,1000,...,9000
+    CHECK(Tasks[1].RunCount == 4);  // 0,2500,5000,7500
+    CHECK(Tasks[0].NextRun == 10000);
+    CHECK(Tasks[1].NextRun == 10000);
+    CHECK(Tasks[0].Overrun == 0 && Tasks[1].Overrun == 0);
+    CHECK(Tasks[0].WCET == 0);
+
+    // 同时到期时A先执行
+    CHECK(Order[0] == 'A' && Order[1] == 'B');
+
+    // 空闲步长不整除周期时释放时刻仍按周期累加，不漂移
+    setup(0, 1000, 2500);
+    run_for(100000, 300);
+    CHECK(Tasks[0].RunCount == 100);
+    CHECK(Tasks[1].RunCount == 40);
+    CHECK(Tasks[0].Overrun == 0);
+}
+
+static void test_wcet(void)
+{
+    static const uint32_t costs[] = {100, 300, 200, 50};
+    uint8_t i;
+
+    setup(0, 1000, 1000);
+    for (i = 0; i < 4; i++)
+    {
+        Cost_A = costs[i];
+        Cost_B = 10;
+        Now = i * 1000;
+        Scheduler_Dispatch();
+    }
+    CHECK(Tasks[0].RunCount == 4);
+    CHECK(Tasks[0].WCET == 300);
+    CHECK(Tasks[1].WCET == 10);
+    CHECK(Tasks[0].Overrun == 0);
+
+    // A执行600us推迟了B的启动，但B仍在截止前完成
+    CHECK(Tasks[1].RunCount == 4);
+    CHECK(Tasks[1].Overrun == 0);
+
+    Scheduler_ResetStats();
+    CHECK(Tasks[0].RunCount == 0 && Tasks[0].WCET == 0 && Tasks[0].Overrun == 0);
+}
+
+static void test_overrun(void)
+{
+    setup(0, 1000, 1000000);
+
+    // 正好在下一次释放时刻结束，不算超时
+    Cost_A = 1000;
+    Scheduler_Dispatch();
+    CHECK(Tasks[0].Overrun == 0);
+    CHECK(Tasks[0].NextRun == 1000);
+
+    // 执行2500us，错过1000后的两次释放：计一次超时，对齐到结束时刻
+    Now = 1000;
+    Cost_A = 2500;
+    Scheduler_Dispatch();
+    CHECK(Now == 3500);
+    CHECK(Tasks[0].Overrun == 1);
+    CHECK(Tasks[0].NextRun == 3500);
+    CHECK(Tasks[0].WCET == 2500);
+
+    // 不补跑：同一时刻连续调度只执行一次
+    Cost_A = 0;
+    Order_Len = 0;
+    Scheduler_Dispatch();
+    Scheduler_Dispatch();
+    Scheduler_Dispatch();
+    CHECK(Order_Len == 1);
+    CHECK(Tasks[0].RunCount == 3);
+    CHECK(Tasks[0].NextRun == 4500);
+
+    // 之后按新的相位正常释放
+    Order_Len = 0;
+    run_for(5000, 50);
+    CHECK(Tasks[0].RunCount == 7); // 4500,5500,6500,7500
+    CHECK(Tasks[0].Overrun == 1);
+}
+
+static void test_wrap(void)
+{
+    // 从回绕前3.5ms开始跑10ms
+    setup(0xFFFFFFFFu - 3499u, 1000, 2500);
+    run_for(10000, 100);
+    CHECK(Tasks[0].RunCount == 10);
+    CHECK(Tasks[1].RunCount == 4);
+    CHECK(Tasks[0].Overrun == 0 && Tasks[1].Overrun == 0);
+    CHECK(Tasks[0].NextRun == 0xFFFFFFFFu - 3499u + 10000u);
+}
+
+int main(void)
+{
+    test_periods();
+    test_wcet();
+    test_overrun();
+    test_wrap();
+    return TEST_DONE();
+}
@@ -0,0 +1,90 @@
+#undef main
+#include "test.h"
+#include "sim.h"
+#include "delay.h"
+#include "Param.h"
+#include "motor.h"
+#include "Encoder.h"
+#include "Brake.h"
+
+/*
+ * 反向脉冲刹车 (user-025)：以 BRAKE_MODE=BRAKE_REVERSE 编译，检查
+ * - 车轮一直在转 (被控对象不受占空比影响) 时，Motor_Stop后的反向脉冲不短于BRAKE_REVERSE_MS、
+ *   不长于再多一个控制周期，与停车时刻在控制周期中的相位无关；之后两路全高刹车
+ * - 前进时反向为负占空比，后退时为正
+ * - 车轮停下后 (速度低于BRAKE_REVERSE_MIN) 提前结束脉冲
+ */
+
+static float Plant_Speed = 0; // 两轮每ms的编码器计数
+
+static void plant(void)
+{
+    Sim_MoveWheels(Plant_Speed, Plant_Speed);
+}
+
+// 以speed(%)转动若干ms让测速稳定，在控制周期内第phase个1ms停车，返回反向脉冲时长 (us)
+// spin: 停车后车轮是否继续转动
+static uint32_t reverse_pulse(float speed, uint32_t phase, uint8_t spin)
+{
+    uint64_t t0;
+    int8_t sign = speed > 0 ? -1 : 1;
+
+    Plant_Speed = speed / 100.0f * MOTOR_MAX_COUNTS / MOTOR_SPEED_WINDOW;
+    Sim_Advance(100000 + phase * 1000 + 500);
+    Motor_Stop();
+    if (!spin)
+        Plant_Speed = 0;
+    t0 = Sim_Now;
+    while (Sim_GetWheelDuty(0) * sign > 0 && Sim_GetWheelDuty(1) * sign > 0 && Sim_Now - t0 < 1000000)
+        Sim_Advance(100);
+    // 结束后两路全高 (短路刹车)
+    CHECK(Sim_GetWheelDuty(0) == 0 && !Sim_WheelCoast(0));
+    CHECK(Sim_GetWheelDuty(1) == 0 && !Sim_WheelCoast(1));
+    return (uint32_t)(Sim_Now - t0);
+}
+
+static void test_full(void)
+{
+    uint32_t phase, us, min = 0xFFFFFFFF, max = 0;
+
+    for (phase = 0; phase < MOTOR_PID_DIV; phase++)
+    {
+        us = reverse_pulse(phase % 2 ? 80.0f : -80.0f, phase, 1);
+        if (us < min)
+            min = us;
+        if (us > max)
+            max = us;
+    }
+    printf("reverse pulse: %u..%u us (BRAKE_REVERSE_MS %d)\n", min, max, BRAKE_REVERSE_MS);
+    CHECK(min >= BRAKE_REVERSE_MS * 1000);
+    CHECK(max <= (BRAKE_REVERSE_MS + MOTOR_PID_DIV) * 1000);
+}
+
+static void test_stopped(void)
+{
+    uint32_t us;
+
+    // 停车后车轮立即停下：测速窗口更新后结束脉冲
+    us = reverse_pulse(80.0f, 3, 0);
+    CHECK(us > 0);
+    printf("reverse pulse, wheel stopped: %u us\n", us);
+    CHECK(us < (MOTOR_SPEED_WINDOW + 2 * MOTOR_PID_DIV) * 1000);
+}
+
+int main(void)
+{
+    Sim_Init();
+    Sim_End = (uint64_t)-1;
+    Sim_PlantTick = plant;
+
+    NVIC_PriorityGroupConfig(NVIC_PriorityGroup_2);
+    delay_init();
+    Param_Load();
+    Motor_Init();
+    Encoder_Init();
+    Motor_Stop();
+
+    test_full();
+    test_stopped();
+    return TEST_DONE();
+}
@@ -0,0 +1,292 @@
+#undef main
+#include <string.h>
+#include <stdlib.h>
+#include "test.h"
+#include "sim.h"
+#include "Serial.h"
+#include "Command.h"
+#include "Telemetry.h"
+#include "Param.h"
+#include "Scheduler.h"
+
+/*
+ * 串口命令 (user-015)：按115200bps满速连续注入字节，按任务表中cmd任务的周期调用Command_Poll，
+ * - 随机字节行 (含0、空格、超长行) 中穿插有效命令，有效命令按顺序执行，接收缓冲区不溢出；
+ *   短垃圾行的错误应答比输入长，发送端可能丢应答，收到的应答须是期望序列的子序列
+ * - 超长行整行丢弃，不会截成一条命令执行；31字节的行仍能执行
+ * - Command_ParseFloat对随机字符串不越界，对合法数字与strtod一致，0.125的倍数等可精确表示的值解析无误差
+ * - 吞吐：满速连续发送有效命令时全部执行，接收端跟得上线速
+ */
+
+#define STREAM_MAX 120000
+#define REPLY_MAX 4096
+
+extern Scheduler_Task Tasks[];
+
+static uint8_t Stream[STREAM_MAX];
+static uint32_t Stream_Len, Stream_Pos;
+static FILE *Wire;
+static uint32_t Cmd_Period;
+
+static uint32_t Rng = 77;
+static uint32_t next(void)
+{
+    Rng ^= Rng << 13;
+    Rng ^= Rng >> 17;
+    Rng ^= Rng << 5;
+    return Rng;
+}
+
+static void put(const void *data, uint32_t len)
+{
+    if (Stream_Len + len > STREAM_MAX)
+        return;
+    memcpy(&Stream[Stream_Len], data, len);
+    Stream_Len += len;
+}
+
+// 满速注入Stream并按cmd周期轮询，直到全部收完并处理
+static void run_stream(void)
+{
+    uint64_t last_poll = Sim_Now;
+
+    Stream_Pos = 0;
+    while (1)
+    {
+        if (Stream_Pos < Stream_Len)
+            Stream_Pos += Sim_UartInputRaw(&Stream[Stream_Pos], Stream_Len - Stream_Pos > 64 ? 64 : Stream_Len - Stream_Pos);
+        Sim_Advance(1000);
+        if (Sim_Now - last_poll >= Cmd_Period)
+        {
+            last_poll += Cmd_Period;
+            Command_Poll();
+        }
+        if (Stream_Pos >= Stream_Len && Sim_UartPending() == 0)
+        {
+            // 最后一个字节已到达，处理完剩余数据
+            Sim_Advance(2 * SIM_UART_BYTE_US);
+            Command_Poll();
+            break;
+        }
+    }
+}
+
+// ================= 应答解码 (COBS帧，见Telemetry.h) =================
+static char Replies[REPLY_MAX][TLM_MAX_PAYLOAD + 1];
+static uint32_t Reply_Num;
+
+static void decode_replies(void)
+{
+    static uint8_t raw[1 << 20];
+    uint8_t frame[TLM_MAX_PAYLOAD + 16];
+    long n, i, start = 0;
+
+    fflush(Wire);
+    n = ftell(Wire);
+    rewind(Wire);
+    n = (long)fread(raw, 1, n < (long)sizeof(raw) ? n : (long)sizeof(raw), Wire);
+    fseek(Wire, 0, SEEK_END);
+
+    Reply_Num = 0;
+    for (i = 0; i < n; i++)
+    {
+        uint32_t out = 0;
+        long p = start;
+
+        if (raw[i] != 0)
+            continue;
+        // COBS解码 raw[start, i)
+        while (p < i && out < sizeof(frame))
+        {
+            uint8_t code = raw[p++], k;
+            for (k = 1; k < code && p < i && out < sizeof(frame); k++)
+                frame[out++] = raw[p++];
+            if (code != 0xFF && p < i && out < sizeof(frame))
+                frame[out++] = 0;
+        }
+        start = i + 1;
+        // 类型(1) 序号(1) 时间戳(4) 负载 CRC(4)
+        if (out >= 10 && frame[0] == TLM_TEXT && Reply_Num < REPLY_MAX)
+        {
+            memcpy(Replies[Reply_Num], frame + 6, out - 10);
+            Replies[Reply_Num][out - 10] = 0;
+            Reply_Num++;
+        }
+    }
+}
+
+// ================= 测试 =================
+
+static void test_fuzz(void)
+{
+    static float expect[REPLY_MAX];
+    uint32_t n_valid = 0, lines = 0, i, r, overrun0 = Serial_GetRxOverrun();
+    char buf[160], want[32];
+    float v;
+
+    Stream_Len = 0;
+    while (Stream_Len < STREAM_MAX - 200 && n_valid < REPLY_MAX)
+    {
+        uint32_t kind = next() % 8, len;
+
+        if (kind == 0)
+        {
+            // 有效命令
+            v = (float)(next() % 1600) * 0.125f;
+            len = (uint32_t)snprintf(buf, sizeof(buf), "stop %g\n", v);
+            expect[n_valid++] = v;
+        }
+        else
+        {
+            // 随机字节行：任意字节 (不含换行)，约1/3超长
+            len = next() % 3 == 0 ? CMD_LINE_MAX + next() % 100 : next() % CMD_LINE_MAX;
+            for (i = 0; i < len; i++)
+            {
+                uint8_t c = (uint8_t)next();
+                buf[i] = (char)(c == '\r' || c == '\n' ? ' ' : c);
+            }
+            // 超长行开头放一条有效命令，整行应被丢弃
+            if (len >= CMD_LINE_MAX && next() % 2)
+                memcpy(buf, "stop 199", 8);
+            buf[len++] = next() % 2 ? '\n' : '\r';
+        }
+        put(buf, len);
+        lines++;
+    }
+
+    run_stream();
+    decode_replies();
+    printf("fuzz: %u lines, %u bytes, %u valid, %u replies, rx overrun %u, tx dropped %u\n",
+           lines, Stream_Len, n_valid, Reply_Num, Serial_GetRxOverrun() - overrun0, Serial_GetDropped());
+    CHECK(Serial_GetRxOverrun() == overrun0);
+
+    // 有效命令的应答按顺序出现 (可能因发送端满而缺失)，其余应答只可能是错误
+    r = 0;
+    for (i = 0; i < Reply_Num; i++)
+    {
+        if (strncmp(Replies[i], "stop=", 5) == 0)
+        {
+            while (r < n_valid)
+            {
+                snprintf(want, sizeof(want), "stop=%.3f", expect[r++]);
+                if (strcmp(Replies[i], want) == 0)
+                    break;
+                CHECK(Serial_GetDropped() != 0); // 不丢应答时必须逐条对应
+            }
+            CHECK(strcmp(Replies[i], want) == 0);
+        }
+        else
+        {
+            CHECK(strcmp(Replies[i], "err cmd") == 0 || strcmp(Replies[i], "err value") == 0);
+        }
+    }
+    CHECK(Param.StopDistance == expect[n_valid - 1]);
+}
+
+static void test_line_limit(void)
+{
+    char line[64];
+
+    // 31字节 (CMD_LINE_MAX-1) 的行可以执行，32字节的整行丢弃
+    Param.StopDistance = 1.0f;
+    Stream_Len = 0;
+    snprintf(line, sizeof(line), "stop%*s2.5\n", CMD_LINE_MAX - 1 - 4 - 3, "");
+    CHECK(strlen(line) == CMD_LINE_MAX);
+    put(line, (uint32_t)strlen(line));
+    run_stream();
+    CHECK(Param.StopDistance == 2.5f);
+
+    Stream_Len = 0;
+    snprintf(line, sizeof(line), "stop%*s3.5\n", CMD_LINE_MAX - 4 - 3, "");
+    put(line, (uint32_t)strlen(line));
+    put("wall 7\n", 7);
+    run_stream();
+    CHECK(Param.StopDistance == 2.5f);
+    CHECK(Param.WallAdjust == 7.0f); // 超长行之后的下一行正常解析
+}
+
+static void test_parse_float(void)
+{
+    char s[24];
+    float v;
+    uint32_t i, k, len;
+
+    for (i = 0; i < 200000; i++)
+    {
+        // 随机字符串：只会读到结尾0，不越界 (由地址检查工具或ASan运行时发现)
+        len = next() % 20;
+        for (k = 0; k < len; k++)
+            s[k] = "0123456789.+- eE\x01\xff"[next() % 18];
+        s[len] = 0;
+        if (Command_ParseFloat(s, &v))
+        {
+            // 接受的字符串必须是 [+-]数字[.数字] 形式，与strtod一致
+            char *end;
+            double d = strtod(s, &end);
+            CHECK(*end == 0);
+            CHECK(fabs(v - d) <= 1e-5 * fabs(d) + 1e-6);
+        }
+    }
+
+    for (i = 0; i < 10000; i++)
+    {
+        double d = (double)(int32_t)(next() % 200001 - 100000) / 1000.0;
+        snprintf(s, sizeof(s), "%.3f", d);
+        CHECK(Command_ParseFloat(s, &v));
+        CHECK(fabs(v - d) <= 1e-5 * fabs(d) + 1e-6);
+        // float可精确表示的值必须精确解析
+        snprintf(s, sizeof(s), "%g", (double)(next() % 16000) * 0.125);
+        CHECK(Command_ParseFloat(s, &v));
+        CHECK(v == (float)strtod(s, NULL));
+    }
+}
+
+static void test_throughput(void)
+{
+    char line[16];
+    uint32_t i, n = 0, overrun0 = Serial_GetRxOverrun();
+    uint64_t t0;
+    float last = 0;
+
+    // 满速连续发送短命令 (应答比命令长，发送端会丢应答，这里不检查)
+    Stream_Len = 0;
+    for (i = 0; Stream_Len < 20000; i++)
+    {
+        put(line, (uint32_t)snprintf(line, sizeof(line), "wall %u\n", i % 50));
+        last = (float)(i % 50);
+        n++;
+    }
+    t0 = Sim_Now;
+    run_stream();
+    printf("throughput: %u commands, %u bytes in %.3f s (%.0f bytes/s, line rate %u), rx overrun %u\n",
+           n, Stream_Len, (Sim_Now - t0) / 1e6, Stream_Len / ((Sim_Now - t0) / 1e6),
+           1000000 / SIM_UART_BYTE_US, Serial_GetRxOverrun() - overrun0);
+    CHECK(Serial_GetRxOverrun() == overrun0);
+    CHECK(Param.WallAdjust == last);
+    // 接收端不拖慢输入：总时间不超过线上传输时间加两个轮询周期
+    CHECK(Sim_Now - t0 <= (uint64_t)Stream_Len * SIM_UART_BYTE_US + 2 * Cmd_Period + 2000);
+}
+
+int main(void)
+{
+    uint8_t i;
+
+    Sim_Init();
+    Sim_End = (uint64_t)-1;
+    Wire = tmpfile();
+    Sim_UartLog = Wire;
+    NVIC_PriorityGroupConfig(NVIC_PriorityGroup_2);
+    Param_Default();
+    Serial_Init();
+    Telemetry_Init();
+
+    // 使用固件任务表中的轮询周期
+    for (i = 0; Tasks[i].Func != Command_Poll; i++);
+    Cmd_Period = Tasks[i].Period;
+
+    test_parse_float();
+    test_fuzz();
+    test_line_limit();
+    test_throughput();
+    return TEST_DONE();
+}
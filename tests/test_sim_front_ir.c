@@ -0,0 +1,138 @@
+#undef main
+#include "test.h"
+#include "sim.h"
+#include "motor.h"
+#include "Maneuver.h"
+#include "delay.h"
+#include "IRSensor.h"
+
+/*
+ * 前方红外快速停车 (user-023)：在寄存器模型上运行EXTI4/EXTI9_5和固件的红外、决策任务，检查
+ * - 前进中RED1/RED2下降沿在中断中立即停车
+ * - 单个毛刺边沿 (消抖后的r1/r2没有确认) 不启动避障动作，等待确认超时后恢复直行
+ * - 前进动作中的毛刺：中止该动作，之后同样恢复直行
+ * - 持续的障碍被消抖确认后才启动避障动作
+ * - 取走锁存事件和停车都保存并恢复PRIMASK，在调用者的关中断区内调用不会打开中断
+ */
+
+void System_Init_All(void);
+void Task_Motor(void);
+void Task_IR(void);
+void Task_Control(void);
+
+static uint32_t Ms = 0;
+
+// 按任务表的周期运行电机(1ms)、红外(5ms)和决策(10ms)任务
+static void run(uint32_t ms)
+{
+    while (ms--)
+    {
+        Sim_Advance(1000);
+        Ms++;
+        Task_Motor();
+        if (Ms % 5 == 0)
+            Task_IR();
+        if (Ms % 10 == 0)
+            Task_Control();
+    }
+}
+
+// 运行直到恢复两轮前进，返回用时 (ms)，期间不应启动动作
+static uint32_t wait_resume(uint32_t limit)
+{
+    uint32_t t;
+
+    for (t = 0; t < limit && !Motor_IsForward(); t++)
+    {
+        run(1);
+        CHECK(!Maneuver_IsBusy());
+    }
+    return t;
+}
+
+static void glitch(uint8_t n)
+{
+    Sim_SetIR(n, 1);
+    Sim_Advance(200);
+    CHECK(!Motor_IsForward()); // 中断中已经停车
+    Sim_SetIR(n, 0);
+}
+
+static void test_glitch(void)
+{
+    uint32_t t;
+
+    run(100);
+    CHECK(Motor_IsForward());
+
+    glitch(1);
+    t = wait_resume(100);
+    printf("glitch: resumed after %u ms\n", t);
+    CHECK(Motor_IsForward());
+    CHECK(t >= 5 && t <= 40);
+}
+
+static void test_glitch_in_maneuver(void)
+{
+    static const Maneuver_Step program[] = {{MV_FORWARD, 100}, {MV_STOP, 100}, {MV_END, 0}};
+    uint32_t t;
+
+    Maneuver_Start(program);
+    run(50);
+    CHECK(Maneuver_IsBusy() && Maneuver_CurrentOp() == MV_FORWARD);
+    CHECK(Motor_IsForward());
+
+    glitch(2);
+    run(10);
+    CHECK(!Maneuver_IsBusy()); // 前进动作被中止，不会停在原地等超时
+    t = wait_resume(100);
+    CHECK(Motor_IsForward());
+    CHECK(t <= 40);
+}
+
+static void test_confirmed(void)
+{
+    uint32_t t;
+
+    run(100);
+    CHECK(Motor_IsForward());
+
+    Sim_SetIR(1, 1);
+    Sim_Advance(50);
+    CHECK(!Motor_IsForward());
+    for (t = 0; t < 50 && !Maneuver_IsBusy(); t++)
+        run(1);
+    printf("confirmed: maneuver after %u ms\n", t);
+    CHECK(Maneuver_IsBusy());
+    CHECK(t <= 30);
+
+    Maneuver_Abort();
+    Sim_SetIR(1, 0);
+}
+
+static void test_nested(void)
+{
+    __disable_irq();
+    IRSensor_TakeFrontEvent();
+    CHECK(__get_PRIMASK() != 0);
+    Motor_Stop();
+    CHECK(__get_PRIMASK() != 0);
+    __enable_irq();
+
+    IRSensor_TakeFrontEvent();
+    Motor_Stop();
+    CHECK(__get_PRIMASK() == 0);
+}
+
+int main(void)
+{
+    Sim_Init();
+    Sim_End = (uint64_t)-1;
+    System_Init_All();
+
+    test_glitch();
+    test_glitch_in_maneuver();
+    test_confirmed();
+    test_nested();
+    return TEST_DONE();
+}
@@ -0,0 +1,144 @@
+#undef main
+#include "test.h"
+#include "sim.h"
+#include "motor.h"
+#include "Latency.h"
+
+/*
+ * 时间直方图 (user-022)：在寄存器模型上检查
+ * - CLZ分档边界：0和1在第0档，2~3在第1档，2^k在第k档，超出范围的值计入最后一档，单档计数饱和
+ * - 反应时间：障碍在Motor_Stop()之前消失不记录，看到障碍后的第一次停车记录一次，重复停车不再记录
+ * - 前进中红外EXTI中断停车只记录一次，之后红外任务和决策任务的停车不重复记录
+ */
+
+void System_Init_All(void);
+void Task_Motor(void);
+void Task_IR(void);
+void Task_Control(void);
+
+static uint32_t Ms = 0;
+
+// 按任务表的周期运行电机(1ms)、红外(5ms)和决策(10ms)任务
+static void run(uint32_t ms)
+{
+    while (ms--)
+    {
+        Sim_Advance(1000);
+        Ms++;
+        Task_Motor();
+        if (Ms % 5 == 0)
+            Task_IR();
+        if (Ms % 10 == 0)
+            Task_Control();
+    }
+}
+
+static uint8_t bin_of(uint32_t us)
+{
+    Latency_Hist h = {{0}, 0, 0};
+    uint8_t i;
+
+    Latency_Add(&h, us);
+    CHECK(h.Count == 1 && h.Max == us);
+    for (i = 0; i < LATENCY_BINS; i++)
+    {
+        if (h.Bins[i])
+            return i;
+    }
+    return 0xFF;
+}
+
+static void test_bins(void)
+{
+    Latency_Hist h = {{0}, 0, 0};
+    uint32_t i;
+    uint8_t k;
+
+    CHECK(bin_of(0) == 0);
+    CHECK(bin_of(1) == 0);
+    CHECK(bin_of(2) == 1);
+    CHECK(bin_of(3) == 1);
+    CHECK(bin_of(4) == 2);
+    for (k = 2; k < LATENCY_BINS; k++)
+    {
+        CHECK(bin_of(1u << k) == k);
+        CHECK(bin_of((1u << k) - 1) == k - 1);
+    }
+    CHECK(bin_of(1u << (LATENCY_BINS - 1)) == LATENCY_BINS - 1);
+    CHECK(bin_of(1u << LATENCY_BINS) == LATENCY_BINS - 1);
+    CHECK(bin_of(0xFFFFFFFFu) == LATENCY_BINS - 1);
+
+    // 单档计数满65535后不再增加，总次数和最大值照常
+    for (i = 0; i < 70000; i++)
+        Latency_Add(&h, 5);
+    Latency_Add(&h, 9);
+    CHECK(h.Bins[2] == 0xFFFF);
+    CHECK(h.Bins[3] == 1);
+    CHECK(h.Count == 70001);
+    CHECK(h.Max == 9);
+}
+
+static void test_react(void)
+{
+    const Latency_Hist *h = Latency_Get(LATENCY_REACT);
+
+    Latency_Reset();
+
+    // 障碍在停车前消失：不记录
+    Latency_Obstacle(1);
+    Sim_Advance(500);
+    Latency_Obstacle(0);
+    Motor_Stop();
+    CHECK(h->Count == 0);
+
+    // 从第一次看到障碍开始计时，持续上报不重新计时
+    Latency_Obstacle(1);
+    Sim_Advance(300);
+    Latency_Obstacle(1);
+    Sim_Advance(300);
+    Motor_Stop();
+    CHECK(h->Count == 1);
+    CHECK(h->Max >= 600 && h->Max <= 610);
+    CHECK(h->Bins[9] == 1);
+
+    // 重复停车不再记录
+    Motor_Stop();
+    Sim_Advance(1000);
+    Motor_Stop();
+    CHECK(h->Count == 1);
+
+    CHECK(Latency_Get(LATENCY_NUM) == 0);
+}
+
+static void test_exti(void)
+{
+    const Latency_Hist *h = Latency_Get(LATENCY_REACT);
+
+    run(100);
+    CHECK(Motor_IsForward());
+    Latency_Reset();
+
+    // 中断中看到障碍并停车，反应时间只有中断本身
+    Sim_SetIR(1, 1);
+    Sim_Advance(50);
+    CHECK(!Motor_IsForward());
+    CHECK(h->Count == 1);
+    CHECK(h->Max <= 50);
+
+    // 红外任务消抖确认、决策任务启动避障动作，都不再记录
+    run(200);
+    CHECK(h->Count == 1);
+    Sim_SetIR(1, 0);
+}
+
+int main(void)
+{
+    Sim_Init();
+    Sim_End = (uint64_t)-1;
+    System_Init_All();
+
+    test_bins();
+    test_react();
+    test_exti();
+    return TEST_DONE();
+}
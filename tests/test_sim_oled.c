@@ -0,0 +1,136 @@
+#undef main
+#include <string.h>
+#include <stdlib.h>
+#include "test.h"
+#include "sim.h"
+#include "oled.h"
+
+/*
+ * OLED显存 (user-016)：用软件I2C后端 (阻塞刷新，仿真未建模I2C) 检查
+ * - 按固件显示界面绘制字符串和各种数字后，显存与 tests/golden/oled_screen.pbm 逐像素一致
+ * - 脏页：只有内容变化的页被标脏，重画相同内容不标脏，超出范围的坐标不写显存，
+ *   刷新后脏页集合清空
+ * 不一致时把实际显存写到 $OUT/oled_screen.pbm (默认 /tmp/car_tests) 便于对比。
+ */
+
+#define GOLDEN "tests/golden/oled_screen.pbm"
+#define PBM_SIZE (OLED_PAGES * 8 * (OLED_WIDTH + 1) + 16)
+
+// 显存转成PBM文本 (P1，每行一个像素行)，返回长度
+static uint32_t to_pbm(char *out)
+{
+    const uint8_t *buf = OLED_GetBuffer();
+    uint32_t n;
+    int x, y;
+
+    n = (uint32_t)sprintf(out, "P1\n%d %d\n", OLED_WIDTH, OLED_PAGES * 8);
+    for (y = 0; y < OLED_PAGES * 8; y++)
+    {
+        for (x = 0; x < OLED_WIDTH; x++)
+            out[n++] = (buf[(y / 8) * OLED_WIDTH + x] >> (y % 8)) & 1 ? '1' : '0';
+        out[n++] = '\n';
+    }
+    out[n] = 0;
+    return n;
+}
+
+static void test_golden(void)
+{
+    static char actual[PBM_SIZE], golden[PBM_SIZE];
+    uint32_t n;
+    size_t g = 0;
+    FILE *f;
+
+    // 固件显示界面 (main.c) 加上各种数字格式
+    OLED_Clear();
+    OLED_ShowString(1, 1, "Dist:");
+    OLED_ShowNum(1, 6, 42, 3);
+    OLED_ShowString(2, 1, "IR  :");
+    OLED_ShowBinNum(2, 6, 0x2D, 6);
+    OLED_ShowSignedNum(3, 1, -1234, 4);
+    OLED_ShowSignedNum(3, 8, 56, 2);
+    OLED_ShowHexNum(3, 12, 0xBEEF, 4);
+    OLED_ShowString(4, 1, "~!@#$%^&*()_+{}|");
+
+    n = to_pbm(actual);
+    f = fopen(GOLDEN, "r");
+    CHECK(f != NULL);
+    if (f)
+    {
+        g = fread(golden, 1, sizeof(golden) - 1, f);
+        fclose(f);
+    }
+    CHECK(g == n);
+    CHECK(memcmp(actual, golden, n) == 0);
+    if (g != n || memcmp(actual, golden, n) != 0)
+    {
+        const char *dir = getenv("OUT");
+        char path[256];
+
+        snprintf(path, sizeof(path), "%s/oled_screen.pbm", dir ? dir : "/tmp/car_tests");
+        f = fopen(path, "w");
+        if (f)
+        {
+            fwrite(actual, 1, n, f);
+            fclose(f);
+            printf("oled: actual framebuffer written to %s\n", path);
+        }
+    }
+}
+
+static void test_dirty(void)
+{
+    const uint8_t *buf = OLED_GetBuffer();
+    uint8_t before[OLED_PAGES * OLED_WIDTH];
+
+    OLED_Clear();
+    CHECK(OLED_GetDirty() == 0xFF);
+    OLED_Update();
+    CHECK(OLED_GetDirty() == 0x00);
+
+    // 第2行占第2、3页
+    OLED_ShowString(2, 1, "Hi");
+    CHECK(OLED_GetDirty() == 0x0C);
+    OLED_Update();
+    CHECK(OLED_GetDirty() == 0x00);
+
+    // 重画相同内容不标脏
+    OLED_ShowString(2, 1, "Hi");
+    OLED_ShowNum(4, 10, 0, 3);
+    CHECK(OLED_GetDirty() == 0xC0);
+    OLED_Update();
+    OLED_ShowNum(4, 10, 0, 3);
+    CHECK(OLED_GetDirty() == 0x00);
+
+    // 空格只覆盖已有像素：在空白处画空格不标脏，擦掉文字才标脏
+    OLED_ShowChar(1, 16, ' ');
+    CHECK(OLED_GetDirty() == 0x00);
+    OLED_ShowString(2, 1, "  ");
+    CHECK(OLED_GetDirty() == 0x0C);
+    OLED_Update();
+
+    // 超出范围的行列不写显存 (行1~4，列1~16)
+    memcpy(before, buf, sizeof(before));
+    OLED_ShowChar(0, 1, 'X');
+    OLED_ShowChar(5, 1, 'X');
+    OLED_ShowChar(1, 0, 'X');
+    OLED_ShowChar(1, 17, 'X');
+    OLED_ShowString(1, 15, "XYZ"); // 只画出前两个
+    CHECK(OLED_GetDirty() == 0x03);
+    CHECK(memcmp(before + 2 * OLED_WIDTH, buf + 2 * OLED_WIDTH, sizeof(before) - 2 * OLED_WIDTH) == 0);
+    CHECK(memcmp(before, buf, 14 * 8) == 0);
+    CHECK(memcmp(before + OLED_WIDTH, buf + OLED_WIDTH, 14 * 8) == 0);
+    OLED_Update();
+    CHECK(OLED_GetDirty() == 0x00);
+    CHECK(!OLED_IsBusy());
+}
+
+int main(void)
+{
+    Sim_Init();
+    Sim_End = (uint64_t)-1;
+
+    test_golden();
+    test_dirty();
+    return TEST_DONE();
+}
@@ -0,0 +1,110 @@
+#undef main
+#include "test.h"
+#include "sim.h"
+#include "Profile.h"
+
+/*
+ * 耗时统计 (user-021)：仿真的DWT_CYCCNT按仿真时间计数，每次读取计SIM_DWT_READ_CYCLES，检查
+ * - Profile_Init标定出的空探针开销等于一次读取的开销，空区域记为0周期
+ * - 区域内推进的仿真时间按72MHz精确计入，次数、最小、最大、均值正确
+ * - 嵌套探针：内层的两次读取计入外层
+ * - 32位计数器回绕时仍得到正确的差值
+ * - 区域表每项都有名称，Profile_Reset清零
+ */
+
+static void test_overhead(void)
+{
+    const Profile_Region *r = Profile_Get(PROF_IR);
+    uint32_t t;
+    uint8_t i;
+
+    CHECK(Profile_GetOverhead() == SIM_DWT_READ_CYCLES);
+    for (i = 0; i < 10; i++)
+    {
+        t = PROFILE_BEGIN();
+        PROFILE_END(PROF_IR, t);
+    }
+    CHECK(r->Count == 10);
+    CHECK(r->Min == 0);
+    CHECK(r->Max == 0);
+}
+
+static void test_timed(void)
+{
+    const Profile_Region *r = Profile_Get(PROF_DISPLAY);
+    uint32_t t, k;
+
+    for (k = 1; k <= 5; k++)
+    {
+        t = PROFILE_BEGIN();
+        Sim_Advance(k * 10);
+        PROFILE_END(PROF_DISPLAY, t);
+    }
+    CHECK(r->Count == 5);
+    CHECK(r->Min == 10 * 72);
+    CHECK(r->Max == 50 * 72);
+    CHECK(r->Sum == 150 * 72);
+    CHECK(Profile_Mean(r) == 30 * 72);
+}
+
+static void test_nested(void)
+{
+    uint32_t outer, inner;
+
+    outer = PROFILE_BEGIN();
+    inner = PROFILE_BEGIN();
+    PROFILE_END(PROF_PID, inner);
+    PROFILE_END(PROF_SYSTICK, outer);
+    CHECK(Profile_Get(PROF_PID)->Max == 0);
+    CHECK(Profile_Get(PROF_SYSTICK)->Max == 2 * SIM_DWT_READ_CYCLES);
+}
+
+static void test_wrap(void)
+{
+    const Profile_Region *r = Profile_Get(PROF_TLM);
+    uint32_t t;
+
+    // 72MHz下约59.65s回绕一次
+    Sim_Advance((uint32_t)(0x100000000ull / 72 - Sim_Now - 500));
+    t = PROFILE_BEGIN();
+    CHECK(t > 0xFFFF0000u);
+    Sim_Advance(1000);
+    CHECK(PROFILE_BEGIN() < t);
+    PROFILE_END(PROF_TLM, t);
+    // 中间多读了一次计数器
+    CHECK(r->Max == 1000 * 72 + SIM_DWT_READ_CYCLES);
+}
+
+static void test_table(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < PROF_NUM; i++)
+    {
+        CHECK(Profile_Get(i)->Name != 0);
+        CHECK(Profile_Get(i)->Name[0] != 0);
+    }
+    CHECK(Profile_Get(PROF_NUM) == 0);
+
+    Profile_Reset();
+    for (i = 0; i < PROF_NUM; i++)
+    {
+        CHECK(Profile_Get(i)->Count == 0);
+        CHECK(Profile_Get(i)->Max == 0);
+        CHECK(Profile_Mean(Profile_Get(i)) == 0);
+    }
+}
+
+int main(void)
+{
+    Sim_Init();
+    Sim_End = (uint64_t)-1;
+    Profile_Init();
+
+    test_overhead();
+    test_timed();
+    test_nested();
+    test_wrap();
+    test_table();
+    return TEST_DONE();
+}
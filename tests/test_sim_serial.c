@@ -0,0 +1,234 @@
+#undef main
+#include <string.h>
+#include "test.h"
+#include "sim.h"
+#include "Serial.h"
+#include "IRSensor.h"
+
+/*
+ * 串口环形缓冲区 (user-013)：在DMA1通道4 + USART1的寄存器模型上检查
+ * - 发送：多次回绕后线上收到的字节与成功写入的字节完全一致，DMA按连续区域分段
+ * - 缓冲区满：整包丢弃、丢弃计数准确、不破坏已排队的数据
+ * - 关中断写入：Serial_Write保存并恢复调用者的PRIMASK，
+ *   关中断期间DMA完成中断挂起，开中断后才释放空间
+ * - 接收：回绕后按顺序读出，缓冲区满时计入溢出
+ * - PA9作为串口TX时，红外快照中的RED4位恒为0 (读到的是发送电平)
+ */
+
+#define STREAM_MAX 20000
+
+static uint8_t Sent[STREAM_MAX];
+static uint32_t Sent_Len;
+static uint32_t Dropped;
+static FILE *Wire;
+
+static uint32_t Rng = 2024;
+static uint32_t next(void)
+{
+    Rng ^= Rng << 13;
+    Rng ^= Rng >> 17;
+    Rng ^= Rng << 5;
+    return Rng;
+}
+
+// 写入一包并记录期望的线上数据
+static uint8_t write_packet(uint16_t len)
+{
+    static uint8_t seq = 0;
+    uint8_t buf[SERIAL_TX_SIZE];
+    uint16_t i;
+
+    for (i = 0; i < len; i++)
+        buf[i] = seq++;
+    if (!Serial_Write(buf, len))
+    {
+        seq -= len;
+        Dropped += len;
+        return 0;
+    }
+    memcpy(&Sent[Sent_Len], buf, len);
+    Sent_Len += len;
+    return 1;
+}
+
+// 等到发送缓冲区清空
+static void drain(void)
+{
+    uint32_t t;
+
+    for (t = 0; t < 100 && Serial_TxFree() != SERIAL_TX_SIZE - 1; t++)
+        Sim_Advance(SERIAL_TX_SIZE * SIM_UART_BYTE_US / 10);
+    CHECK(Serial_TxFree() == SERIAL_TX_SIZE - 1);
+}
+
+// 线上数据与写入的数据一致
+static void check_wire(void)
+{
+    static uint8_t got[STREAM_MAX];
+    long n;
+
+    fflush(Wire);
+    n = ftell(Wire);
+    CHECK(n == (long)Sent_Len);
+    rewind(Wire);
+    CHECK(fread(got, 1, Sent_Len, Wire) == Sent_Len);
+    CHECK(memcmp(got, Sent, Sent_Len) == 0);
+    fseek(Wire, 0, SEEK_END);
+}
+
+static void test_wrap(void)
+{
+    uint32_t i, ok = 0;
+
+    // 随机包长，写入间隔短于发送时间，缓冲区反复回绕，偶尔写满
+    for (i = 0; i < 400 && Sent_Len < STREAM_MAX - SERIAL_TX_SIZE; i++)
+    {
+        ok += write_packet(1 + next() % 60);
+        Sim_Advance(next() % 3000);
+    }
+    drain();
+    printf("wrap: %u packets, %u bytes sent, %u dropped\n", ok, Sent_Len, Dropped);
+    CHECK(Sent_Len > 8 * SERIAL_TX_SIZE);
+    CHECK(Dropped > 0);
+    CHECK(Serial_GetDropped() == Dropped);
+    check_wire();
+}
+
+static void test_full(void)
+{
+    uint32_t before = Serial_GetDropped();
+
+    drain();
+    // 超过容量的包永远放不下
+    CHECK(!write_packet(SERIAL_TX_SIZE));
+    CHECK(Serial_GetDropped() == before + SERIAL_TX_SIZE);
+
+    // 正好写满 (容量为SIZE-1，DMA正在发送的部分仍占用空间)
+    CHECK(write_packet(SERIAL_TX_SIZE - 1));
+    CHECK(Serial_TxFree() == 0);
+    CHECK(!write_packet(1));
+    CHECK(Serial_GetDropped() == before + SERIAL_TX_SIZE + 1);
+
+    // 发送完一段后空间逐步释放
+    Sim_Advance(SERIAL_TX_SIZE * SIM_UART_BYTE_US);
+    CHECK(Serial_TxFree() == SERIAL_TX_SIZE - 1);
+    CHECK(write_packet(10));
+    drain();
+    check_wire();
+}
+
+static void test_primask(void)
+{
+    uint16_t free;
+
+    drain();
+
+    // 开中断时调用，返回后仍为开中断
+    CHECK(__get_PRIMASK() == 0);
+    CHECK(write_packet(5));
+    CHECK(__get_PRIMASK() == 0);
+
+    // 调用者已关中断 (如在临界区中发遥测)：返回后保持关中断
+    __disable_irq();
+    CHECK(write_packet(20));
+    CHECK(__get_PRIMASK() == 1);
+    free = Serial_TxFree();
+
+    // 关中断期间DMA已传完，但完成中断挂起，空间不释放
+    Sim_Advance(200 * SIM_UART_BYTE_US);
+    CHECK(Serial_TxFree() == free);
+    // 写满时丢弃也恢复PRIMASK
+    CHECK(!write_packet(SERIAL_TX_SIZE - 1));
+    CHECK(__get_PRIMASK() == 1);
+    __enable_irq();
+
+    // 开中断后完成中断执行，启动剩余部分
+    Sim_Advance(0);
+    CHECK(Serial_TxFree() > free);
+    drain();
+    check_wire();
+}
+
+static void test_rx(void)
+{
+    char line[49], got[64];
+    uint8_t c;
+    uint32_t i, k, n;
+
+    // 每行读完再发下一行，累计字节数远超缓冲区，读指针多次回绕
+    for (i = 0; i < 40; i++)
+    {
+        snprintf(line, sizeof(line), "line %u %08x", i, next());
+        Sim_UartInput(line);
+        Sim_Advance((strlen(line) + 2) * SIM_UART_BYTE_US);
+        n = 0;
+        while (Serial_Read(&c) && n < sizeof(got) - 1)
+            got[n++] = c;
+        got[n] = 0;
+        CHECK(n == strlen(line) + 1 && got[n - 1] == '\n');
+        got[n - 1] = 0;
+        CHECK(strcmp(got, line) == 0);
+    }
+    CHECK(Serial_GetRxOverrun() == 0);
+    CHECK(!Serial_Read(&c));
+
+    // 不读取时连续收6行 (48个字符加换行) 共294字节：缓冲区存SIZE-1个，其余计入溢出
+    memset(line, 'a', 48);
+    line[48] = 0;
+    for (k = 0; k < 6; k++)
+    {
+        Sim_UartInput(line);
+        Sim_Advance(49 * SIM_UART_BYTE_US);
+    }
+    Sim_Advance(10 * SIM_UART_BYTE_US);
+    n = 0;
+    while (Serial_Read(&c))
+        n++;
+    CHECK(n == SERIAL_RX_SIZE - 1);
+    CHECK(Serial_GetRxOverrun() == 6 * 49 - (SERIAL_RX_SIZE - 1));
+}
+
+static void test_red4(void)
+{
+    uint8_t mask;
+
+    // PA9为上拉输入时RED4正常检测
+    IRSensor_Init();
+    Sim_SetIR(4, 1);
+    IRSensor_Snapshot();
+    mask = IRSensor_Snapshot();
+    CHECK(mask & IR_MASK_RED4);
+
+    // 串口接管PA9后不再报告RED4，其他位不受影响
+    Sim_SetIR(1, 1);
+    Serial_Init();
+    IRSensor_Snapshot();
+    mask = IRSensor_Snapshot();
+    CHECK(!(mask & IR_MASK_RED4));
+    CHECK(mask & IR_MASK_RED1);
+
+    // 发送数据时TX线上的低电平也不会变成RED4
+    Sim_SetIR(4, 0);
+    CHECK(write_packet(64));
+    Sim_Advance(10 * SIM_UART_BYTE_US);
+    CHECK(!(IRSensor_Snapshot() & IR_MASK_RED4));
+    drain();
+    Sim_SetIR(1, 0);
+}
+
+int main(void)
+{
+    Sim_Init();
+    Sim_End = (uint64_t)-1;
+    Wire = tmpfile();
+    Sim_UartLog = Wire;
+    NVIC_PriorityGroupConfig(NVIC_PriorityGroup_2);
+    Serial_Init();
+
+    test_wrap();
+    test_full();
+    test_primask();
+    test_rx();
+    test_red4();
+    return TEST_DONE();
+}
@@ -0,0 +1,92 @@
+#undef main
+#include <math.h>
+#include "test.h"
+#include "sim.h"
+#include "world.h"
+#include "delay.h"
+#include "Param.h"
+#include "motor.h"
+#include "Encoder.h"
+
+/*
+ * 按编码器原地转向 (user-008)：在整车模型的空场地上转90度，停稳后检查
+ * - 编码器换算的转角 (轮子转过的角度) 在目标附近
+ * - 车体实际转角：打滑使实际角度偏小，加上停车后的惯性滑行，仍在容差内
+ * - 转向不超时，且左右转对称
+ */
+
+#define RAD2DEG(r) ((r) * 180.0f / 3.14159265f)
+#define TURN_TOL_DEG 3.0f    // 车体实际转角容差 (含2%打滑)
+#define ENCODER_TOL_DEG 2.0f // 编码器转角容差 (量化和停车后的滑行)
+
+static float wrap_deg(float d)
+{
+    while (d > 180.0f)
+        d -= 360.0f;
+    while (d < -180.0f)
+        d += 360.0f;
+    return d;
+}
+
+// 转向deg度并停稳，返回车体实际转角，*enc_deg返回编码器换算的转角
+static float turn(float deg, float *enc_deg, uint32_t *ms)
+{
+    float theta0 = World.Theta;
+    int32_t l0 = Encoder_GetLeft(), r0 = Encoder_GetRight();
+    uint64_t t0 = Sim_Now;
+
+    // 与Task_Motor相同，每1ms查询一次
+    Motor_TurnStart(deg);
+    while (!Motor_TurnDone())
+        Sim_Advance(1000);
+    *ms = (uint32_t)((Sim_Now - t0) / 1000);
+    Motor_Stop();
+    Sim_Advance(500000);
+
+    *enc_deg = RAD2DEG((Encoder_GetRight() - r0 - (Encoder_GetLeft() - l0)) / ENCODER_COUNTS_PER_CM / TRACK_WIDTH_CM);
+    return wrap_deg(RAD2DEG(World.Theta - theta0));
+}
+
+static void check_turn(float deg)
+{
+    float actual, enc;
+    uint32_t ms;
+
+    actual = turn(deg, &enc, &ms);
+    printf("turn %+.0f: body %+.1f encoder %+.1f in %u ms\n", deg, actual, enc, ms);
+    CHECK(ms < TURN_TIMEOUT);
+    CHECK_NEAR(enc, deg, ENCODER_TOL_DEG);
+    CHECK_NEAR(actual, deg, TURN_TOL_DEG);
+    // 原地转向，车体基本不平移
+    CHECK(World.Collisions == 0);
+}
+
+int main(void)
+{
+    float x0, y0;
+
+    Sim_Init();
+    Sim_End = (uint64_t)-1;
+    Sim_PlantTick = World_Tick;
+    CHECK(World_Load("/dev/null")); // 无墙的空场地，模型参数取默认值
+
+    NVIC_PriorityGroupConfig(NVIC_PriorityGroup_2);
+    delay_init();
+    Param_Load();
+    Motor_Init();
+    Encoder_Init();
+    Motor_Stop();
+    Sim_Advance(100000);
+
+    x0 = World.X;
+    y0 = World.Y;
+    check_turn(-90.0f);
+    check_turn(90.0f);
+    check_turn(90.0f);
+    check_turn(-90.0f);
+    // 四次转向后回到原朝向，位置漂移很小
+    CHECK_NEAR(RAD2DEG(World.Theta), 0.0f, 2 * TURN_TOL_DEG);
+    CHECK(hypotf(World.X - x0, World.Y - y0) < 3.0f);
+
+    return TEST_DONE();
+}
@@ -0,0 +1,116 @@
+#undef main
+#include "test.h"
+#include "sim.h"
+#include "Ultrasound.h"
+
+/*
+ * 超声波测距引擎 (user-001)：在寄存器模型上运行TIM1 + EXTI1，检查
+ * - 测距精度 (1us计数的量化误差以内)
+ * - 回波下降沿到结果发布的延时 (在EXTI中断内完成，不等主循环)
+ * - 距离变化到读到新结果的延时不超过一个测量周期加回波时间
+ * - 超出量程返回999，无回波返回-1，每个周期恰好发布一次
+ * - Ultrasound_Read成对返回序号和结果，并恢复调用者的PRIMASK
+ */
+
+#define STEP_US 10
+#define TRIG_SLACK_US 50
+
+// 推进到结果序号变化，返回推进的时间 (us)；超时返回0
+static uint32_t wait_publish(uint32_t timeout_us)
+{
+    uint32_t seq = Ultrasound_GetSeq();
+    uint32_t t;
+
+    for (t = 0; t < timeout_us; t += STEP_US)
+    {
+        Sim_Advance(STEP_US);
+        if (Ultrasound_GetSeq() != seq)
+            return t + STEP_US;
+    }
+    return 0;
+}
+
+static void check_distance(float d)
+{
+    uint64_t t0, fall = 0;
+    uint32_t width = (uint32_t)(d / 0.017f);
+    uint8_t echo = 0, last = 0;
+    uint32_t seq;
+
+    Sim_SetDistance(d);
+    t0 = Sim_Now;
+
+    // 改变距离前已开始的测量用旧距离，等到下一次完整测量
+    wait_publish(ULTRA_PERIOD + 1000);
+    seq = Ultrasound_GetSeq();
+    while (Ultrasound_GetSeq() == seq && Sim_Now - t0 < 3 * ULTRA_PERIOD)
+    {
+        Sim_Advance(STEP_US);
+        echo = (GPIOB->IDR & GPIO_Pin_1) != 0;
+        if (last && !echo)
+            fall = Sim_Now;
+        last = echo;
+    }
+
+    CHECK(Ultrasound_GetSeq() == seq + 1);
+    CHECK_NEAR(Ultrasound_GetLatest(), d, 0.02);
+    // 回波下降沿所在的推进步内已经发布
+    CHECK(fall != 0 && Sim_Now - fall <= STEP_US);
+    // 距离变化后最迟两个周期 (当前周期 + 一次完整测量) 读到新值，另加TRIG脉冲和推进步长
+    CHECK(Sim_Now - t0 <= 2 * ULTRA_PERIOD + SIM_ECHO_DELAY_US + width + TRIG_SLACK_US);
+}
+
+int main(void)
+{
+    static const float dist[] = {2.0f, 10.0f, 15.3f, 50.0f, 123.4f, 250.0f, 340.0f};
+    uint32_t i, seq;
+    uint64_t t;
+    float d;
+
+    Sim_Init();
+    Sim_End = (uint64_t)-1;
+    NVIC_PriorityGroupConfig(NVIC_PriorityGroup_2);
+    Ultrasound_Init();
+
+    // 初始化后尚无结果
+    CHECK(Ultrasound_GetLatest() < 0);
+
+    for (i = 0; i < sizeof(dist) / sizeof(dist[0]); i++)
+        check_distance(dist[i]);
+
+    // 回波宽度超过20ms视为超出量程
+    Sim_SetDistance(450.0f);
+    wait_publish(ULTRA_PERIOD + 1000);
+    wait_publish(2 * ULTRA_PERIOD);
+    CHECK(Ultrasound_GetLatest() == 999.0f);
+
+    // 没有回波起始 (传感器断开)：周期结束时发布-1
+    Sim_SetDistance(-1.0f);
+    wait_publish(ULTRA_PERIOD + 1000);
+    CHECK(wait_publish(2 * ULTRA_PERIOD) != 0);
+    CHECK(Ultrasound_GetLatest() == -1.0f);
+
+    // 每个测量周期恰好发布一次
+    Sim_SetDistance(30.0f);
+    seq = Ultrasound_GetSeq();
+    Sim_Advance(10 * ULTRA_PERIOD);
+    CHECK(Ultrasound_GetSeq() - seq == 10);
+
+    // 序号和结果成对读取
+    seq = Ultrasound_Read(&d);
+    CHECK(seq == Ultrasound_GetSeq());
+    CHECK_NEAR(d, 30.0f, 0.02);
+    CHECK(__get_PRIMASK() == 0);
+    __disable_irq();
+    CHECK(Ultrasound_Read(&d) == seq);
+    CHECK(__get_PRIMASK() == 1);
+    __enable_irq();
+
+    // 读取结果不阻塞 (不推进仿真时间)
+    t = Sim_Now;
+    Ultrasound_GetLatest();
+    Test_Distance();
+    CHECK(Sim_Now == t);
+
+    return TEST_DONE();
+}
@@ -0,0 +1,117 @@
+/*
+ * Format.c 主机端微基准：对比原 OLED_Pow/serial_Pow 写法与 Format_* 的耗时，
+ * 并逐个比对输出是否一致。
+ *
+ *   gcc -O2 -I. tools/format_bench.c Format.c -o format_bench && ./format_bench
+ *
+ * 主机上的结果只反映相对开销；Cortex-M3 上UDIV需2~12个周期，差距更大。
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "Format.h"
+
+#define N 2000000
+
+// 原实现 (每位一次幂运算 + 除法 + 取模)
+static uint32_t old_pow(uint32_t X, uint32_t Y)
+{
+    uint32_t Result = 1;
+    while (Y--) Result *= X;
+    return Result;
+}
+
+static void old_dec(char *Buf, uint32_t Number, uint8_t Length)
+{
+    uint8_t i;
+    for (i = 0; i < Length; i++)
+        Buf[i] = Number / old_pow(10, Length - i - 1) % 10 + '0';
+}
+
+static void old_hex(char *Buf, uint32_t Number, uint8_t Length)
+{
+    uint8_t i, SingleNumber;
+    for (i = 0; i < Length; i++)
+    {
+        SingleNumber = Number / old_pow(16, Length - i - 1) % 16;
+        Buf[i] = SingleNumber < 10 ? SingleNumber + '0' : SingleNumber - 10 + 'A';
+    }
+}
+
+static void old_bin(char *Buf, uint32_t Number, uint8_t Length)
+{
+    uint8_t i;
+    for (i = 0; i < Length; i++)
+        Buf[i] = Number / old_pow(2, Length - i - 1) % 2 + '0';
+}
+
+static uint32_t rng = 12345;
+static uint32_t next(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+typedef void (*fmt_fn)(char *, uint32_t, uint8_t);
+
+static double bench(fmt_fn fn, const uint32_t *vals, uint8_t len)
+{
+    static char buf[32];
+    volatile char sink = 0;
+    double t = now();
+    int i;
+    for (i = 0; i < N; i++)
+    {
+        fn(buf, vals[i & 1023], len);
+        sink ^= buf[0];
+    }
+    return (now() - t) * 1e9 / N;
+}
+
+// 原十进制写法在Length>10时10的幂溢出，只比对1~10位
+static int check(fmt_fn a, fmt_fn b, uint8_t maxlen)
+{
+    char x[32], y[32];
+    uint8_t len;
+    int i;
+    for (i = 0; i < 200000; i++)
+    {
+        uint32_t v = next();
+        if (i & 1) v >>= next() & 31;
+        len = 1 + next() % maxlen;
+        a(x, v, len);
+        b(y, v, len);
+        if (memcmp(x, y, len) != 0)
+            return 0;
+    }
+    return 1;
+}
+
+int main(void)
+{
+    static uint32_t vals[1024];
+    int i;
+    for (i = 0; i < 1024; i++) vals[i] = next();
+
+    if (!check(old_dec, Format_Dec, 10) || !check(old_hex, Format_Hex, 8) || !check(old_bin, Format_Bin, 32))
+    {
+        printf("mismatch\n");
+        return 1;
+    }
+    printf("outputs match\n");
+    printf("dec 10: old %6.1f ns  new %6.1f ns\n", bench(old_dec, vals, 10), bench(Format_Dec, vals, 10));
+    printf("dec  5: old %6.1f ns  new %6.1f ns\n", bench(old_dec, vals, 5), bench(Format_Dec, vals, 5));
+    printf("hex  8: old %6.1f ns  new %6.1f ns\n", bench(old_hex, vals, 8), bench(Format_Hex, vals, 8));
+    printf("bin 16: old %6.1f ns  new %6.1f ns\n", bench(old_bin, vals, 16), bench(Format_Bin, vals, 16));
+    return 0;
+}
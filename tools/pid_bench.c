@@ -0,0 +1,129 @@
+/*
+ * PID.c 主机端微基准：对比浮点PID_Calc与定点PIDQ_Calc的耗时，
+ * 并比对两者在同一输入序列上的输出偏差 (容差同tests/test_pid.c)。
+ *
+ *   gcc -O2 -DSTM32F10X_MD -I. -Istart -Ilibrary -Iuser tools/pid_bench.c PID.c -o pid_bench && ./pid_bench
+ *
+ * 主机有FPU，结果只反映相对开销；Cortex-M3无FPU，浮点加乘都要调用软件库，
+ * 定点版本的优势更大，板上耗时用Profile的"pid"区域测量。
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include "PID.h"
+
+#define N 2000000
+#define TOL 0.05f // 输出偏差容差 (占空比%)
+
+static uint32_t rng = 12345;
+static uint32_t next(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// 电机速度环的参数 (motor.h)
+static void setup(PID_TypeDef *f, PIDQ_TypeDef *q, uint8_t mode)
+{
+    PIDQ_Config(q, mode, Q16(1.5f), Q16(0.1f), Q16(0.05f), Q16(-100.0f), Q16(100.0f));
+    q->Kf = Q16(1.0f);
+    q->Kaw = Q16(0.5f);
+    q->DFilter = Q16(0.3f);
+    PID_Config(f, mode, Q16_TO_FLOAT(q->Kp), Q16_TO_FLOAT(q->Ki), Q16_TO_FLOAT(q->Kd), -100.0f, 100.0f);
+    f->Kf = Q16_TO_FLOAT(q->Kf);
+    f->Kaw = Q16_TO_FLOAT(q->Kaw);
+    f->DFilter = Q16_TO_FLOAT(q->DFilter);
+}
+
+static float in_t[1024], in_a[1024];
+
+static double bench_float(uint8_t mode)
+{
+    PID_TypeDef f;
+    PIDQ_TypeDef q;
+    volatile float sink = 0;
+    double t;
+    int i;
+
+    setup(&f, &q, mode);
+    t = now();
+    for (i = 0; i < N; i++)
+        sink += PID_Calc(&f, in_t[i & 1023], in_a[i & 1023]);
+    return (now() - t) * 1e9 / N;
+}
+
+static double bench_fixed(uint8_t mode)
+{
+    static q16_t qt[1024], qa[1024];
+    PID_TypeDef f;
+    PIDQ_TypeDef q;
+    volatile q16_t sink = 0;
+    double t;
+    int i;
+
+    for (i = 0; i < 1024; i++)
+    {
+        qt[i] = Q16(in_t[i]);
+        qa[i] = Q16(in_a[i]);
+    }
+    setup(&f, &q, mode);
+    t = now();
+    for (i = 0; i < N; i++)
+        sink += PIDQ_Calc(&q, qt[i & 1023], qa[i & 1023]);
+    return (now() - t) * 1e9 / N;
+}
+
+static float max_diff(uint8_t mode)
+{
+    PID_TypeDef f;
+    PIDQ_TypeDef q;
+    float d, max = 0;
+    int i;
+
+    setup(&f, &q, mode);
+    for (i = 0; i < N; i++)
+    {
+        d = fabsf(PID_Calc(&f, in_t[i & 1023], in_a[i & 1023]) -
+                  Q16_TO_FLOAT(PIDQ_Calc(&q, Q16(in_t[i & 1023]), Q16(in_a[i & 1023]))));
+        if (d > max)
+            max = d;
+    }
+    return max;
+}
+
+int main(void)
+{
+    float target = 0, dp, di;
+    int i;
+
+    // 目标每32步阶跃一次，实测值在目标附近抖动；取Q16.16可精确表示的值
+    for (i = 0; i < 1024; i++)
+    {
+        if (i % 32 == 0)
+            target = Q16_TO_FLOAT(Q16(((int32_t)(next() % 20001) - 10000) / 100.0f));
+        in_t[i] = target;
+        in_a[i] = Q16_TO_FLOAT(Q16(target + ((int32_t)(next() % 6001) - 3000) / 100.0f));
+    }
+
+    dp = max_diff(PID_POSITIONAL);
+    di = max_diff(PID_INCREMENTAL);
+    printf("max diff: positional %.6f  incremental %.6f (tol %.2f)\n", dp, di, TOL);
+    if (dp > TOL || di > TOL)
+    {
+        printf("mismatch\n");
+        return 1;
+    }
+    printf("positional:  float %6.1f ns  fixed %6.1f ns\n", bench_float(PID_POSITIONAL), bench_fixed(PID_POSITIONAL));
+    printf("incremental: float %6.1f ns  fixed %6.1f ns\n", bench_float(PID_INCREMENTAL), bench_fixed(PID_INCREMENTAL));
+    return 0;
+}
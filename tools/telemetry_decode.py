@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+"""Decode the car's binary telemetry stream (see Telemetry.h) into CSV files.
+
+Usage:
+    python3 telemetry_decode.py capture.bin [out_prefix]
+    python3 telemetry_decode.py /dev/ttyUSB0 [out_prefix]   (needs pyserial)
+
+Writes one CSV per frame type: <prefix>_encoder.csv, <prefix>_pid.csv,
+<prefix>_sensor.csv, <prefix>_profile.csv, <prefix>_hist.csv (bin k counts
+values in [2^k, 2^(k+1)) us). Text frames (command replies) are printed on
+stdout.
+CRC errors and sequence gaps are reported on stderr.
+"""
+import csv
+import struct
+import sys
+
+TEXT_FRAME = 4
+PID_FIELDS = ["target", "speed", "error", "integral", "dterm", "output"]
+
+# type -> (name, struct format, column names, scale per column)
+FRAME_TYPES = {
+    1: ("encoder", "<iihh",
+        ["left_count", "right_count", "left_speed", "right_speed"],
+        [1, 1, 0.01, 0.01]),
+    2: ("pid", "<12h",
+        ["left_" + f for f in PID_FIELDS] + ["right_" + f for f in PID_FIELDS],
+        [0.01] * 12),
+    3: ("sensor", "<BhB",
+        ["ir_mask", "distance_cm", "maneuver_op"],
+        [1, 0.1, 1]),
+    5: ("profile", "<B8sIIII",
+        ["region", "name", "count", "min_cycles", "max_cycles", "mean_cycles"],
+        [1, 1, 1, 1, 1, 1]),
+    6: ("hist", "<BII24H",
+        ["hist", "count", "max_us"] + ["bin%d" % i for i in range(24)],
+        [1] * 27),
+}
+
+
+def crc32_stm32(data):
+    """CRC unit of the STM32F1: CRC-32 (0x04C11DB7), init 0xFFFFFFFF,
+    no reflection, no final XOR, fed one little-endian 32-bit word at a time."""
+    data = data + b"\x00" * (-len(data) % 4)
+    crc = 0xFFFFFFFF
+    for (word,) in struct.iter_unpack("<I", data):
+        crc ^= word
+        for _ in range(32):
+            crc = ((crc << 1) ^ 0x04C11DB7) if crc & 0x80000000 else (crc << 1)
+            crc &= 0xFFFFFFFF
+    return crc
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data):
+            raise ValueError("bad COBS code")
+        out += data[i + 1:i + code]
+        i += code
+        if code < 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def frames(stream):
+    """Yield raw (COBS-decoded) frames from a byte iterator of chunks."""
+    buf = bytearray()
+    for chunk in stream:
+        buf += chunk
+        while True:
+            end = buf.find(b"\x00")
+            if end < 0:
+                break
+            packet = bytes(buf[:end])
+            del buf[:end + 1]
+            if packet:
+                yield packet
+
+
+def open_stream(path):
+    if path.startswith("/dev/") or path.upper().startswith("COM"):
+        import serial  # pyserial
+        port = serial.Serial(path, 115200, timeout=1)
+
+        def gen():
+            while True:
+                yield port.read(4096)
+        return gen()
+
+    def gen_file():
+        with open(path, "rb") as f:
+            while True:
+                chunk = f.read(4096)
+                if not chunk:
+                    return
+                yield chunk
+    return gen_file()
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(__doc__)
+        return 1
+    prefix = sys.argv[2] if len(sys.argv) > 2 else "telemetry"
+
+    writers = {}
+    files = []
+    last_seq = None
+    stats = {"frames": 0, "crc": 0, "cobs": 0, "gap": 0, "unknown": 0}
+
+    try:
+        for packet in frames(open_stream(sys.argv[1])):
+            try:
+                raw = cobs_decode(packet)
+            except ValueError:
+                stats["cobs"] += 1
+                continue
+            if len(raw) < 10:
+                stats["cobs"] += 1
+                continue
+            body, (crc,) = raw[:-4], struct.unpack("<I", raw[-4:])
+            if crc32_stm32(body) != crc:
+                stats["crc"] += 1
+                continue
+
+            ftype, seq, time_us = struct.unpack("<BBI", body[:6])
+            if last_seq is not None and seq != (last_seq + 1) & 0xFF:
+                stats["gap"] += (seq - last_seq - 1) & 0xFF
+            last_seq = seq
+            stats["frames"] += 1
+
+            if ftype == TEXT_FRAME:
+                print(body[6:].decode("ascii", "replace"))
+                continue
+            if ftype not in FRAME_TYPES:
+                stats["unknown"] += 1
+                continue
+            name, fmt, cols, scale = FRAME_TYPES[ftype]
+            values = struct.unpack(fmt, body[6:6 + struct.calcsize(fmt)])
+            values = [v.rstrip(b"\0").decode("ascii", "replace") if isinstance(v, bytes) else v
+                      for v in values]
+
+            if name not in writers:
+                f = open("%s_%s.csv" % (prefix, name), "w", newline="")
+                files.append(f)
+                writers[name] = csv.writer(f)
+                writers[name].writerow(["seq", "time_us"] + cols)
+            writers[name].writerow([seq, time_us] +
+                                   [round(v * s, 3) if s != 1 else v for v, s in zip(values, scale)])
+    except KeyboardInterrupt:
+        pass
+    finally:
+        for f in files:
+            f.close()
+
+    print("frames=%(frames)d crc_errors=%(crc)d cobs_errors=%(cobs)d "
+          "lost=%(gap)d unknown=%(unknown)d" % stats, file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -23,6 +23,9 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "stm32f10x_it.h"
+#include "delay.h"
+#include "motor.h"
+#include "Profile.h"
 
 /** @addtogroup STM32F10x_StdPeriph_Template
   * @{
@@ -134,6 +137,12 @@ void PendSV_Handler(void)
   */
 void SysTick_Handler(void)
 {
+  uint32_t t;
+
+  Delay_IncTick();
+  t = PROFILE_BEGIN();
+  Motor_ControlTick();
+  PROFILE_END(PROF_SYSTICK, t);
 }
 
 /******************************************************************************/